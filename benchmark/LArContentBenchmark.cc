@@ -0,0 +1,424 @@
+/**
+ *  @file   benchmark/LArContentBenchmark.cc
+ *
+ *  @brief  Standalone benchmark, replaying persisted events through a chosen reconstruction settings file.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "larpandoracontent/LArContent.h"
+#include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
+#include "larpandoracontent/LArPersistency/EventReadingAlgorithm.h"
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace pandora;
+
+namespace lar_benchmark
+{
+
+/**
+ *  @brief  Parameters class
+ */
+class Parameters
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    Parameters();
+
+    std::string m_settingsFile;      ///< The path to the pandora settings file
+    std::string m_geometryFileName;  ///< The path to the geometry file (if not specified in the settings file)
+    std::string m_eventFileNameList; ///< Colon-separated list of event files (if not specified in the settings file)
+    std::string m_outputFileName;    ///< The path to the json output file (stdout if empty)
+    int m_nEventsToProcess;          ///< The maximum number of events to process in each repetition (all events if negative)
+    unsigned int m_nRepetitions;     ///< The number of times to replay the events
+    unsigned int m_nWarmUpEvents;    ///< The number of events, at the start of each repetition, to leave out of the latency statistics
+};
+
+typedef std::vector<double> LatencyVector;
+
+/**
+ *  @brief  Parse the command line arguments
+ *
+ *  @param  argc the argument count
+ *  @param  argv the argument vector
+ *  @param  parameters to receive the parameters
+ *
+ *  @return whether the arguments could be parsed
+ */
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters);
+
+/**
+ *  @brief  Print the usage string
+ */
+void PrintUsage();
+
+/**
+ *  @brief  Create and configure the primary pandora instance
+ *
+ *  @param  parameters the parameters
+ *
+ *  @return the address of the primary pandora instance
+ */
+const Pandora *CreatePandoraInstance(const Parameters &parameters);
+
+/**
+ *  @brief  Replay the events once, recording the latency of each event
+ *
+ *  @param  parameters the parameters
+ *  @param  latencies to receive the per-event latencies, in ms
+ */
+void ProcessEvents(const Parameters &parameters, LatencyVector &latencies);
+
+/**
+ *  @brief  Get a percentile of a sorted list of latencies, using linear interpolation between the closest ranks
+ *
+ *  @param  sortedLatencies the sorted latencies
+ *  @param  percentile the percentile, in the range [0, 100]
+ *
+ *  @return the percentile latency
+ */
+double GetPercentile(const LatencyVector &sortedLatencies, const double percentile);
+
+/**
+ *  @brief  Get the peak resident set size of this process
+ *
+ *  @return the peak resident set size, in kB
+ */
+long GetPeakRSS();
+
+/**
+ *  @brief  Escape a string for use as a json string value, escaping quotes, backslashes and control characters
+ *
+ *  @param  input the input string
+ *
+ *  @return the escaped string, without enclosing quotes
+ */
+std::string EscapeJsonString(const std::string &input);
+
+/**
+ *  @brief  Write the benchmark results, in json format
+ *
+ *  @param  parameters the parameters
+ *  @param  latencies the per-event latencies, in ms
+ *  @param  totalTime the total wall-clock time spent processing events, in s
+ *  @param  nEvents the total number of events processed, including warm-up events
+ *  @param  stream the output stream
+ */
+void WriteResults(const Parameters &parameters, const LatencyVector &latencies, const double totalTime, const unsigned int nEvents, std::ostream &stream);
+
+} // namespace lar_benchmark
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    using namespace lar_benchmark;
+
+    try
+    {
+        Parameters parameters;
+
+        if (!ParseCommandLine(argc, argv, parameters))
+            return 1;
+
+        LatencyVector allLatencies;
+        unsigned int nEvents(0);
+        double totalTime(0.);
+
+        for (unsigned int iRepetition = 0; iRepetition < parameters.m_nRepetitions; ++iRepetition)
+        {
+            LatencyVector latencies;
+            ProcessEvents(parameters, latencies);
+
+            nEvents += latencies.size();
+
+            for (unsigned int iEvent = 0; iEvent < latencies.size(); ++iEvent)
+            {
+                totalTime += latencies.at(iEvent) / 1000.;
+
+                if (iEvent >= parameters.m_nWarmUpEvents)
+                    allLatencies.push_back(latencies.at(iEvent));
+            }
+        }
+
+        if (parameters.m_outputFileName.empty())
+        {
+            WriteResults(parameters, allLatencies, totalTime, nEvents, std::cout);
+        }
+        else
+        {
+            std::ofstream outputFile(parameters.m_outputFileName);
+            WriteResults(parameters, allLatencies, totalTime, nEvents, outputFile);
+        }
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cerr << "LArContentBenchmark: Exception caught " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_benchmark
+{
+
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters)
+{
+    int c(0);
+
+    while ((c = getopt(argc, argv, "i:g:e:o:n:r:w:h")) != -1)
+    {
+        switch (c)
+        {
+            case 'i':
+                parameters.m_settingsFile = optarg;
+                break;
+            case 'g':
+                parameters.m_geometryFileName = optarg;
+                break;
+            case 'e':
+                parameters.m_eventFileNameList = optarg;
+                break;
+            case 'o':
+                parameters.m_outputFileName = optarg;
+                break;
+            case 'n':
+                parameters.m_nEventsToProcess = std::atoi(optarg);
+                break;
+            case 'r':
+                parameters.m_nRepetitions = std::max(1, std::atoi(optarg));
+                break;
+            case 'w':
+                parameters.m_nWarmUpEvents = std::max(0, std::atoi(optarg));
+                break;
+            case 'h':
+            default:
+                PrintUsage();
+                return false;
+        }
+    }
+
+    if (parameters.m_settingsFile.empty())
+    {
+        PrintUsage();
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PrintUsage()
+{
+    std::cout << std::endl
+              << "./bin/LArContentBenchmark " << std::endl
+              << "    -i Settings.xml         (required) [settings file, which must run the LArEventReading algorithm]" << std::endl
+              << "    -g Geometry.xml         (optional) [geometry file, overriding any named in the settings file]" << std::endl
+              << "    -e EventFiles.pndr      (optional) [colon-separated list of event files, overriding any named in the settings file]" << std::endl
+              << "    -n NEventsToProcess     (optional) [maximum number of events per repetition, all events by default]" << std::endl
+              << "    -r NRepetitions         (optional) [number of times to replay the events, 1 by default]" << std::endl
+              << "    -w NWarmUpEvents        (optional) [number of events per repetition left out of latency statistics, 0 by default]" << std::endl
+              << "    -o Results.json         (optional) [output file for the json results, stdout by default]" << std::endl
+              << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Pandora *CreatePandoraInstance(const Parameters &parameters)
+{
+    const Pandora *const pPandora(new Pandora("LArContentBenchmark"));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterAlgorithms(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterBasicPlugins(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new lar_content::LArPseudoLayerPlugin));
+    PANDORA_THROW_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraApi::SetLArTransformationPlugin(*pPandora, new lar_content::LArRotationalTransformationPlugin));
+    MultiPandoraApi::AddPrimaryPandoraInstance(pPandora);
+
+    if (!parameters.m_geometryFileName.empty() || !parameters.m_eventFileNameList.empty())
+    {
+        lar_content::EventReadingAlgorithm::ExternalEventReadingParameters *const pEventReadingParameters(
+            new lar_content::EventReadingAlgorithm::ExternalEventReadingParameters);
+        pEventReadingParameters->m_geometryFileName = parameters.m_geometryFileName;
+        pEventReadingParameters->m_eventFileNameList = parameters.m_eventFileNameList;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetExternalParameters(*pPandora, "LArEventReading", pEventReadingParameters));
+    }
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, parameters.m_settingsFile));
+    return pPandora;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ProcessEvents(const Parameters &parameters, LatencyVector &latencies)
+{
+    // ATTN A fresh instance per repetition, so that each repetition replays the same events from the same initial state
+    const Pandora *const pPandora(CreatePandoraInstance(parameters));
+
+    try
+    {
+        while ((parameters.m_nEventsToProcess < 0) || (static_cast<int>(latencies.size()) < parameters.m_nEventsToProcess))
+        {
+            const auto startTime(std::chrono::steady_clock::now());
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pPandora));
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pPandora));
+            latencies.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count());
+        }
+    }
+    catch (const StopProcessingException &)
+    {
+        // ATTN Raised by the event reading algorithm once all event files have been processed
+    }
+
+    MultiPandoraApi::DeletePandoraInstances(pPandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double GetPercentile(const LatencyVector &sortedLatencies, const double percentile)
+{
+    if (sortedLatencies.empty())
+        return 0.;
+
+    const double rank(0.01 * percentile * (sortedLatencies.size() - 1));
+    const unsigned int lowerIndex(static_cast<unsigned int>(std::floor(rank)));
+    const unsigned int upperIndex(std::min(lowerIndex + 1, static_cast<unsigned int>(sortedLatencies.size() - 1)));
+    const double fraction(rank - lowerIndex);
+
+    return sortedLatencies.at(lowerIndex) + fraction * (sortedLatencies.at(upperIndex) - sortedLatencies.at(lowerIndex));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+long GetPeakRSS()
+{
+    struct rusage usage;
+
+    if (0 != getrusage(RUSAGE_SELF, &usage))
+        return 0;
+
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string EscapeJsonString(const std::string &input)
+{
+    std::string output;
+    output.reserve(input.size());
+
+    for (const char character : input)
+    {
+        switch (character)
+        {
+            case '"':
+                output += "\\\"";
+                break;
+            case '\\':
+                output += "\\\\";
+                break;
+            case '\b':
+                output += "\\b";
+                break;
+            case '\f':
+                output += "\\f";
+                break;
+            case '\n':
+                output += "\\n";
+                break;
+            case '\r':
+                output += "\\r";
+                break;
+            case '\t':
+                output += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20)
+                {
+                    const char *const hexDigits("0123456789abcdef");
+                    output += "\\u00";
+                    output += hexDigits[(static_cast<unsigned char>(character) >> 4) & 0xf];
+                    output += hexDigits[static_cast<unsigned char>(character) & 0xf];
+                }
+                else
+                {
+                    output += character;
+                }
+                break;
+        }
+    }
+
+    return output;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void WriteResults(const Parameters &parameters, const LatencyVector &latencies, const double totalTime, const unsigned int nEvents, std::ostream &stream)
+{
+    LatencyVector sortedLatencies(latencies);
+    std::sort(sortedLatencies.begin(), sortedLatencies.end());
+
+    double meanLatency(0.);
+    for (const double latency : sortedLatencies)
+        meanLatency += latency;
+
+    if (!sortedLatencies.empty())
+        meanLatency /= sortedLatencies.size();
+
+    // ATTN Field names and units are part of the output format, so should only ever be added to, never changed
+    stream << "{" << std::endl
+           << "  \"formatVersion\": 1," << std::endl
+           << "  \"settingsFile\": \"" << EscapeJsonString(parameters.m_settingsFile) << "\"," << std::endl
+           << "  \"nRepetitions\": " << parameters.m_nRepetitions << "," << std::endl
+           << "  \"nWarmUpEventsPerRepetition\": " << parameters.m_nWarmUpEvents << "," << std::endl
+           << "  \"nEvents\": " << nEvents << "," << std::endl
+           << "  \"nTimedEvents\": " << sortedLatencies.size() << "," << std::endl
+           << "  \"totalTimeS\": " << totalTime << "," << std::endl
+           << "  \"eventsPerSecond\": " << (totalTime > 0. ? nEvents / totalTime : 0.) << "," << std::endl
+           << "  \"latencyMs\": {" << std::endl
+           << "    \"mean\": " << meanLatency << "," << std::endl
+           << "    \"min\": " << (sortedLatencies.empty() ? 0. : sortedLatencies.front()) << "," << std::endl
+           << "    \"p50\": " << GetPercentile(sortedLatencies, 50.) << "," << std::endl
+           << "    \"p90\": " << GetPercentile(sortedLatencies, 90.) << "," << std::endl
+           << "    \"p99\": " << GetPercentile(sortedLatencies, 99.) << "," << std::endl
+           << "    \"max\": " << (sortedLatencies.empty() ? 0. : sortedLatencies.back()) << std::endl
+           << "  }," << std::endl
+           << "  \"peakRssKb\": " << GetPeakRSS() << std::endl
+           << "}" << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+Parameters::Parameters() :
+    m_nEventsToProcess(-1),
+    m_nRepetitions(1),
+    m_nWarmUpEvents(0)
+{
+}
+
+} // namespace lar_benchmark
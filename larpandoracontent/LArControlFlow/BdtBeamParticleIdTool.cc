@@ -296,14 +296,62 @@ bool BdtBeamParticleIdTool::PassesQualityCuts(const float purity, const float co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void BdtBeamParticleIdTool::GetAdaBoostDecisionTreeScores(const SliceFeaturesVector &sliceFeaturesVector, FloatVector &adaBDTScores) const
+{
+    // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray.  -1.f is the minimum score
+    // possible for a weighted bdt.
+    FloatVector scores(sliceFeaturesVector.size(), -1.f);
+    AdaBoostDecisionTree::MvaFeatureVectorList featuresList;
+    std::vector<unsigned int> scoredSliceIndices;
+
+    for (unsigned int sliceIndex = 0, nSlices = sliceFeaturesVector.size(); sliceIndex < nSlices; ++sliceIndex)
+    {
+        const SliceFeatures &sliceFeatures(sliceFeaturesVector.at(sliceIndex));
+
+        if (!sliceFeatures.IsFeatureVectorAvailable())
+            continue;
+
+        LArMvaHelper::MvaFeatureVector featureVector;
+
+        try
+        {
+            sliceFeatures.FillFeatureVector(featureVector);
+        }
+        catch (const StatusCodeException &)
+        {
+            std::cout << "BdtBeamParticleIdTool::GetAdaBoostDecisionTreeScores - unable to fill feature vector" << std::endl;
+            continue;
+        }
+
+        featuresList.push_back(featureVector);
+        scoredSliceIndices.push_back(sliceIndex);
+    }
+
+    if (!featuresList.empty())
+    {
+        AdaBoostDecisionTree::ScoreVector featuresScores;
+        m_adaBoostDecisionTree.CalculateClassificationScores(featuresList, featuresScores);
+
+        for (unsigned int featuresIndex = 0, nFeatures = featuresList.size(); featuresIndex < nFeatures; ++featuresIndex)
+            scores.at(scoredSliceIndices.at(featuresIndex)) = static_cast<float>(featuresScores.at(featuresIndex));
+    }
+
+    adaBDTScores.swap(scores);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void BdtBeamParticleIdTool::SelectPfosByAdaBDTScore(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
     const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, PfoList &selectedPfos) const
 {
+    FloatVector adaBDTScores;
+    this->GetAdaBoostDecisionTreeScores(sliceFeaturesVector, adaBDTScores);
+
     // Calculate the probability of each slice that passes the minimum probability cut
     std::vector<UintFloatPair> sliceIndexAdaBDTScorePairs;
     for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
     {
-        const float nuAdaBDTScore(sliceFeaturesVector.at(sliceIndex).GetAdaBoostDecisionTreeScore(m_adaBoostDecisionTree));
+        const float nuAdaBDTScore(adaBDTScores.at(sliceIndex));
 
         for (const ParticleFlowObject *const pPfo : crSliceHypotheses.at(sliceIndex))
         {
@@ -662,30 +710,6 @@ void BdtBeamParticleIdTool::SliceFeatures::FillFeatureVector(LArMvaHelper::MvaFe
     featureVector.insert(featureVector.end(), m_featureVector.begin(), m_featureVector.end());
 }
 
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-float BdtBeamParticleIdTool::SliceFeatures::GetAdaBoostDecisionTreeScore(const AdaBoostDecisionTree &adaBoostDecisionTree) const
-{
-    // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray.  -1.f is the minimum score
-    // possible for a weighted bdt.
-    if (!this->IsFeatureVectorAvailable())
-        return -1.f;
-
-    LArMvaHelper::MvaFeatureVector featureVector;
-
-    try
-    {
-        this->FillFeatureVector(featureVector);
-    }
-    catch (const StatusCodeException &statusCodeException)
-    {
-        std::cout << "BdtBeamParticleIdTool::SliceFeatures::GetAdaBoostDecisionTreeScore - unable to fill feature vector" << std::endl;
-        return -1.f;
-    }
-
-    return LArMvaHelper::CalculateClassificationScore(adaBoostDecisionTree, featureVector);
-}
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -256,15 +256,6 @@ private:
          */
         void FillFeatureVector(LArMvaHelper::MvaFeatureVector &featureVector) const;
 
-        /**
-         *  @brief  Get the probability that this slice contains a beam particle
-         *
-         *  @param  adaBoostDecisionTree the adaptive boost decision tree used to calculate the probability
-         *
-         *  @return the probability that the slice contains a beam particle
-         */
-        float GetAdaBoostDecisionTreeScore(const AdaBoostDecisionTree &adaBoostDecisionTree) const;
-
     private:
         /**
          *  @brief  Select a given fraction of a slice's calo hits that are closest to the beam spot
@@ -370,6 +361,14 @@ private:
      */
     bool PassesQualityCuts(const float purity, const float completeness) const;
 
+    /**
+     *  @brief  Get the AdaBDT score that each slice contains a beam particle interaction, scoring all the slices in a single batch
+     *
+     *  @param  sliceFeaturesVector vector holding the slice features
+     *  @param  adaBDTScores to receive the AdaBDT scores, in the order of the slice features
+     */
+    void GetAdaBoostDecisionTreeScores(const SliceFeaturesVector &sliceFeaturesVector, pandora::FloatVector &adaBDTScores) const;
+
     /**
      *  @brief  Select pfos based on the AdaBDT score that the slice contains a beam particle interaction
      *
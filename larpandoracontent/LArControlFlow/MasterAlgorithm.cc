@@ -18,6 +18,7 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 #include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
@@ -27,6 +28,10 @@
 
 #include "larpandoracontent/LArUtility/PfoMopUpBaseAlgorithm.h"
 
+#include <algorithm>
+#include <chrono>
+#include <future>
+
 using namespace pandora;
 
 namespace lar_content
@@ -48,6 +53,21 @@ MasterAlgorithm::MasterAlgorithm() :
     m_pSlicingWorkerInstance(nullptr),
     m_pSliceNuWorkerInstance(nullptr),
     m_pSliceCRWorkerInstance(nullptr),
+    m_validateConcurrentSliceReconstruction(false),
+    m_pSliceNuValidationWorkerInstance(nullptr),
+    m_pSliceCRValidationWorkerInstance(nullptr),
+    m_nSliceWorkerThreads(1),
+    m_nCRWorkerThreads(1),
+    m_printCRWorkerTimings(false),
+    m_shouldOverlapCRWorkerResets(false),
+    m_crWorkersAlreadyReset(false),
+    m_useHitCopyTable(false),
+    m_printHitCopyStatistics(false),
+    m_nHitCopies(0),
+    m_nTableHitCopies(0),
+    m_hitCopyTimeNs(0),
+    m_hitCopyTableBuildTimeNs(0),
+    m_hitCopyTableLookupTimeNs(0),
     m_fullWidthCRWorkerWireGaps(true),
     m_passMCParticlesToWorkerInstances(false),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
@@ -160,10 +180,15 @@ StatusCode MasterAlgorithm::Run()
     if (m_passMCParticlesToWorkerInstances)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CopyMCParticles());
 
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->BuildHitCopyTable());
+
     PfoToFloatMap stitchedPfosToX0Map;
     VolumeIdToHitListMap volumeIdToHitListMap;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetVolumeIdToHitListMap(volumeIdToHitListMap));
 
+    // ATTN Destruction of an unfinished std::async future blocks, so no reset can outlive this event, even on early return
+    std::future<StatusCode> crWorkerResetFuture;
+
     if (m_shouldRunAllHitsCosmicReco)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunCosmicRayReconstruction(volumeIdToHitListMap));
@@ -171,6 +196,14 @@ StatusCode MasterAlgorithm::Run()
         PfoToLArTPCMap pfoToLArTPCMap;
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RecreateCosmicRayPfos(pfoToLArTPCMap));
 
+        // ATTN Nothing owned by the cosmic-ray worker instances is needed once their pfos are recreated, so their reset can overlap the
+        // remaining master instance stages, on a single background task. The later stages themselves still run one after another.
+        if (m_shouldOverlapCRWorkerResets)
+        {
+            crWorkerResetFuture = std::async(
+                std::launch::async, [this]() { return this->ResetWorkerInstances(m_crWorkerInstances, m_nCRWorkerThreads); });
+        }
+
         if (m_shouldRunStitching)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->StitchCosmicRayPfos(pfoToLArTPCMap, stitchedPfosToX0Map));
     }
@@ -192,6 +225,15 @@ StatusCode MasterAlgorithm::Run()
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SelectBestSliceHypotheses(nuSliceHypotheses, crSliceHypotheses));
     }
 
+    if (crWorkerResetFuture.valid())
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, crWorkerResetFuture.get());
+        m_crWorkersAlreadyReset = true;
+    }
+
+    if (m_printHitCopyStatistics)
+        this->PrintHitCopyStatistics();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -219,10 +261,34 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
             m_pSlicingWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_slicingSettingsFile, "SlicingWorker");
 
         if (m_shouldRunNeutrinoRecoOption)
+        {
             m_pSliceNuWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker");
+            m_sliceNuWorkerInstances.push_back(m_pSliceNuWorkerInstance);
+
+            for (unsigned int iWorker = 1; iWorker < m_nSliceWorkerThreads; ++iWorker)
+            {
+                m_sliceNuWorkerInstances.push_back(
+                    this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker" + std::to_string(iWorker)));
+            }
+
+            if (m_validateConcurrentSliceReconstruction && (m_nSliceWorkerThreads > 1))
+                m_pSliceNuValidationWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuValidationWorker");
+        }
 
         if (m_shouldRunCosmicRecoOption)
+        {
             m_pSliceCRWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker");
+            m_sliceCRWorkerInstances.push_back(m_pSliceCRWorkerInstance);
+
+            for (unsigned int iWorker = 1; iWorker < m_nSliceWorkerThreads; ++iWorker)
+            {
+                m_sliceCRWorkerInstances.push_back(
+                    this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker" + std::to_string(iWorker)));
+            }
+
+            if (m_validateConcurrentSliceReconstruction && (m_nSliceWorkerThreads > 1))
+                m_pSliceCRValidationWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRValidationWorker");
+        }
     }
     catch (const StatusCodeException &statusCodeException)
     {
@@ -244,10 +310,12 @@ StatusCode MasterAlgorithm::CopyMCParticles() const
     PandoraInstanceList pandoraWorkerInstances(m_crWorkerInstances);
     if (m_pSlicingWorkerInstance)
         pandoraWorkerInstances.push_back(m_pSlicingWorkerInstance);
-    if (m_pSliceNuWorkerInstance)
-        pandoraWorkerInstances.push_back(m_pSliceNuWorkerInstance);
-    if (m_pSliceCRWorkerInstance)
-        pandoraWorkerInstances.push_back(m_pSliceCRWorkerInstance);
+    pandoraWorkerInstances.insert(pandoraWorkerInstances.end(), m_sliceNuWorkerInstances.begin(), m_sliceNuWorkerInstances.end());
+    pandoraWorkerInstances.insert(pandoraWorkerInstances.end(), m_sliceCRWorkerInstances.begin(), m_sliceCRWorkerInstances.end());
+    if (m_pSliceNuValidationWorkerInstance)
+        pandoraWorkerInstances.push_back(m_pSliceNuValidationWorkerInstance);
+    if (m_pSliceCRValidationWorkerInstance)
+        pandoraWorkerInstances.push_back(m_pSliceCRValidationWorkerInstance);
 
     LArMCParticleFactory mcParticleFactory;
 
@@ -262,6 +330,80 @@ StatusCode MasterAlgorithm::CopyMCParticles() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::BuildHitCopyTable()
+{
+    m_hitCopyTable.m_hitToIndexMap.clear();
+    m_hitCopyTable.m_parameters.clear();
+    m_hitCopyTable.m_mcContributions.clear();
+    m_nHitCopies = 0;
+    m_nTableHitCopies = 0;
+    m_hitCopyTimeNs = 0;
+    m_hitCopyTableBuildTimeNs = 0;
+    m_hitCopyTableLookupTimeNs = 0;
+
+    if (!m_useHitCopyTable)
+        return STATUS_CODE_SUCCESS;
+
+    const auto startTime(std::chrono::steady_clock::now());
+
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputHitListName, pCaloHitList));
+
+    m_hitCopyTable.m_hitToIndexMap.reserve(pCaloHitList->size());
+    m_hitCopyTable.m_parameters.reserve(pCaloHitList->size());
+    m_hitCopyTable.m_mcContributions.reserve(pCaloHitList->size());
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        // ATTN Hits that are not lar calo hits are left out of the table; Copy will report the problem if they are ever copied
+        const LArCaloHit *const pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
+
+        if (!pLArCaloHit)
+            continue;
+
+        m_hitCopyTable.m_hitToIndexMap.emplace(pCaloHit, m_hitCopyTable.m_parameters.size());
+        m_hitCopyTable.m_parameters.emplace_back();
+        pLArCaloHit->FillParameters(m_hitCopyTable.m_parameters.back());
+        m_hitCopyTable.m_mcContributions.emplace_back();
+
+        if (m_passMCParticlesToWorkerInstances)
+            this->GetMCContributions(pLArCaloHit, m_hitCopyTable.m_mcContributions.back());
+    }
+
+    m_hitCopyTableBuildTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MasterAlgorithm::PrintHitCopyStatistics() const
+{
+    const unsigned int nTableEntries(m_hitCopyTable.m_parameters.size());
+    unsigned int nMCContributions(0);
+
+    for (const MCContributionVector &mcContributions : m_hitCopyTable.m_mcContributions)
+        nMCContributions += mcContributions.size();
+
+    const unsigned int entryBytes(sizeof(LArCaloHitParameters) + sizeof(MCContributionVector) + sizeof(HitCopyTable::HitToIndexMap::value_type));
+    const unsigned int tableBytes(nTableEntries * entryBytes + nMCContributions * sizeof(MCContributionVector::value_type));
+
+    std::cout << "MasterAlgorithm: " << m_nHitCopies << " hit copies (" << m_nTableHitCopies << " via hit copy table of " << nTableEntries
+              << " hits, " << tableBytes / 1024 << " kB), " << m_hitCopyTimeNs / 1000000. << " ms copying" << std::endl;
+
+    if (0 == nTableEntries)
+        return;
+
+    // ATTN Building a table entry is the same work as preparing a hit for a copy without the table
+    const double buildMs(m_hitCopyTableBuildTimeNs / 1000000.), lookupMs(m_hitCopyTableLookupTimeNs / 1000000.);
+    const double withoutTableMs(buildMs * m_nTableHitCopies / nTableEntries);
+
+    std::cout << "MasterAlgorithm: hit copy table " << tableBytes / 1024 << " kB, build " << buildMs << " ms, lookups " << lookupMs
+              << " ms, saving " << (withoutTableMs - buildMs - lookupMs) << " ms of " << withoutTableMs << " ms hit preparation" << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
     const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
@@ -297,7 +439,8 @@ StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volume
 
 StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
-    unsigned int workerCounter(0);
+    PandoraInstanceList activeCRWorkers;
+    std::vector<const CaloHitList *> activeHitLists;
 
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
     {
@@ -307,13 +450,47 @@ StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMa
         if (volumeIdToHitListMap.end() == iter)
             continue;
 
-        for (const CaloHit *const pCaloHit : iter->second.m_allHitList)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
+        activeCRWorkers.push_back(pCRWorker);
+        activeHitLists.push_back(&iter->second.m_allHitList);
+    }
 
-        if (m_printOverallRecoStatus)
-            std::cout << "Running cosmic-ray reconstruction worker instance " << ++workerCounter << " of " << m_crWorkerInstances.size() << std::endl;
+    const unsigned int nActiveWorkers(activeCRWorkers.size());
+    std::vector<double> workerTimes(nActiveWorkers, 0.);
+
+    if (m_printOverallRecoStatus && (m_nCRWorkerThreads > 1))
+        std::cout << "Running " << nActiveWorkers << " cosmic-ray reconstruction worker instance(s) using " << m_nCRWorkerThreads << " thread(s)" << std::endl;
+
+    // ATTN Each worker instance owns its own lar tpc volume and is only accessed by the single thread processing it. Results are
+    // collected in the master instance by RecreateCosmicRayPfos, once all threads have been joined.
+    try
+    {
+        LArThreadingHelper::ParallelFor(nActiveWorkers, m_nCRWorkerThreads, [&](const unsigned int iWorker) {
+            const Pandora *const pCRWorker(activeCRWorkers.at(iWorker));
+            const auto startTime(std::chrono::steady_clock::now());
+
+            for (const CaloHit *const pCaloHit : *activeHitLists.at(iWorker))
+                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
 
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
+            if (m_printOverallRecoStatus && (m_nCRWorkerThreads < 2))
+                std::cout << "Running cosmic-ray reconstruction worker instance " << (iWorker + 1) << " of " << m_crWorkerInstances.size() << std::endl;
+
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
+            workerTimes.at(iWorker) = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        });
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "MasterAlgorithm: Exception during cosmic-ray reconstruction " << statusCodeException.ToString() << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
+
+    if (m_printCRWorkerTimings)
+    {
+        for (unsigned int iWorker = 0; iWorker < nActiveWorkers; ++iWorker)
+        {
+            std::cout << "Cosmic-ray worker instance for volume " << activeCRWorkers.at(iWorker)->GetGeometry()->GetLArTPC().GetLArTPCVolumeId()
+                      << ": " << activeHitLists.at(iWorker)->size() << " hits, " << workerTimes.at(iWorker) << " ms" << std::endl;
+        }
     }
 
     return STATUS_CODE_SUCCESS;
@@ -529,68 +706,274 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
         selectedSliceVector = std::move(sliceVector);
     }
 
-    unsigned int sliceCounter(0);
-
-    for (const CaloHitList &sliceHits : selectedSliceVector)
+    if (m_nSliceWorkerThreads > 1)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunConcurrentSliceReconstruction(selectedSliceVector, nuSliceHypotheses, crSliceHypotheses));
+    }
+    else
     {
-        for (const CaloHit *const pSliceCaloHit : sliceHits)
+        unsigned int sliceCounter(0);
+
+        for (const CaloHitList &sliceHits : selectedSliceVector)
         {
-            // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
-            const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+            for (const CaloHit *const pSliceCaloHit : sliceHits)
+            {
+                // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
+                const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+
+                if (m_shouldRunNeutrinoRecoOption)
+                    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceNuWorkerInstance, pCaloHitInMaster));
+
+                if (m_shouldRunCosmicRecoOption)
+                    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceCRWorkerInstance, pCaloHitInMaster));
+            }
 
             if (m_shouldRunNeutrinoRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceNuWorkerInstance, pCaloHitInMaster));
+            {
+                if (m_printOverallRecoStatus)
+                    std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
+
+                const PfoList *pSliceNuPfos(nullptr);
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceNuWorkerInstance, pSliceNuPfos));
+                nuSliceHypotheses.push_back(*pSliceNuPfos);
+
+                for (const ParticleFlowObject *const pPfo : *pSliceNuPfos)
+                {
+                    PandoraContentApi::ParticleFlowObject::Metadata metadata;
+                    metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
+                    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+                }
+            }
 
             if (m_shouldRunCosmicRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceCRWorkerInstance, pCaloHitInMaster));
+            {
+                if (m_printOverallRecoStatus)
+                    std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
+
+                const PfoList *pSliceCRPfos(nullptr);
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceCRWorkerInstance, pSliceCRPfos));
+                crSliceHypotheses.push_back(*pSliceCRPfos);
+
+                for (const ParticleFlowObject *const pPfo : *pSliceCRPfos)
+                {
+                    PandoraContentApi::ParticleFlowObject::Metadata metadata;
+                    metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
+                    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+                }
+            }
+
+            ++sliceCounter;
         }
+    }
 
-        if (m_shouldRunNeutrinoRecoOption)
-        {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
+    // ATTN: If we swapped these objects at the start, be sure to swap them back in case we ever want to use sliceVector
+    // after this function
+    if (!(m_shouldRunSlicing && !m_sliceSelectionToolVector.empty()))
+        sliceVector = std::move(selectedSliceVector);
 
-            const PfoList *pSliceNuPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceNuWorkerInstance, pSliceNuPfos));
-            nuSliceHypotheses.push_back(*pSliceNuPfos);
+    if (m_shouldRunNeutrinoRecoOption && m_shouldRunCosmicRecoOption && (nuSliceHypotheses.size() != crSliceHypotheses.size()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::RunConcurrentSliceReconstruction(
+    const SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const
+{
+    const unsigned int nSlices(sliceVector.size());
+    const unsigned int nWorkers(std::max(m_sliceNuWorkerInstances.size(), m_sliceCRWorkerInstances.size()));
+
+    if ((m_shouldRunNeutrinoRecoOption && (m_sliceNuWorkerInstances.size() != nWorkers)) ||
+        (m_shouldRunCosmicRecoOption && (m_sliceCRWorkerInstances.size() != nWorkers)) || (0 == nWorkers))
+    {
+        return STATUS_CODE_NOT_INITIALIZED;
+    }
 
-            for (const ParticleFlowObject *const pPfo : *pSliceNuPfos)
+    if (m_printOverallRecoStatus)
+        std::cout << "Running slice worker instances for " << nSlices << " slice(s) using " << nWorkers << " thread(s)" << std::endl;
+
+    SliceHypotheses nuHypotheses(m_shouldRunNeutrinoRecoOption ? nSlices : 0), crHypotheses(m_shouldRunCosmicRecoOption ? nSlices : 0);
+
+    // ATTN Each thread owns one nu and one cr worker instance, which are only accessed from that thread; pfo metadata in the worker
+    // instances is only altered below, once all threads have been joined
+    try
+    {
+        LArThreadingHelper::ParallelFor(nWorkers, nWorkers, [&](const unsigned int iWorker) {
+            for (unsigned int iSlice = iWorker; iSlice < nSlices; iSlice += nWorkers)
             {
-                PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+                if (m_shouldRunNeutrinoRecoOption)
+                    this->ProcessSlice(m_sliceNuWorkerInstances.at(iWorker), sliceVector.at(iSlice), nuHypotheses.at(iSlice));
+
+                if (m_shouldRunCosmicRecoOption)
+                    this->ProcessSlice(m_sliceCRWorkerInstances.at(iWorker), sliceVector.at(iSlice), crHypotheses.at(iSlice));
             }
+        });
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "MasterAlgorithm: Exception during concurrent slice reconstruction " << statusCodeException.ToString() << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
+
+    if (m_validateConcurrentSliceReconstruction)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ValidateConcurrentSliceReconstruction(sliceVector, nuHypotheses, crHypotheses));
+
+    for (unsigned int iSlice = 0; iSlice < nSlices; ++iSlice)
+    {
+        if (m_shouldRunNeutrinoRecoOption)
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetSliceIndex(nuHypotheses.at(iSlice), iSlice));
+            nuSliceHypotheses.push_back(nuHypotheses.at(iSlice));
         }
 
         if (m_shouldRunCosmicRecoOption)
         {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetSliceIndex(crHypotheses.at(iSlice), iSlice));
+            crSliceHypotheses.push_back(crHypotheses.at(iSlice));
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MasterAlgorithm::ProcessSlice(const Pandora *const pWorker, const CaloHitList &sliceHits, PfoList &sliceHypothesis) const
+{
+    for (const CaloHit *const pSliceCaloHit : sliceHits)
+    {
+        // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
+        const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pWorker, pCaloHitInMaster));
+    }
 
-            const PfoList *pSliceCRPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceCRWorkerInstance, pSliceCRPfos));
-            crSliceHypotheses.push_back(*pSliceCRPfos);
+    const PfoList *pSlicePfos(nullptr);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pWorker));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pWorker, pSlicePfos));
+    sliceHypothesis = *pSlicePfos;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::ValidateConcurrentSliceReconstruction(
+    const SliceVector &sliceVector, const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses) const
+{
+    if ((m_shouldRunNeutrinoRecoOption && !m_pSliceNuValidationWorkerInstance) || (m_shouldRunCosmicRecoOption && !m_pSliceCRValidationWorkerInstance))
+        return STATUS_CODE_NOT_INITIALIZED;
+
+    unsigned int nMismatches(0);
 
-            for (const ParticleFlowObject *const pPfo : *pSliceCRPfos)
+    try
+    {
+        // ATTN Each validation worker instance processes every slice, in slice order, exactly as the single worker instance does under serial processing
+        for (unsigned int iSlice = 0; iSlice < sliceVector.size(); ++iSlice)
+        {
+            if (m_shouldRunNeutrinoRecoOption)
+            {
+                PfoList serialHypothesis;
+                this->ProcessSlice(m_pSliceNuValidationWorkerInstance, sliceVector.at(iSlice), serialHypothesis);
+
+                if (!this->AreMatchingSliceHypotheses(nuSliceHypotheses.at(iSlice), serialHypothesis))
+                {
+                    std::cout << "MasterAlgorithm: concurrent and serial nu hypotheses differ for slice " << iSlice << std::endl;
+                    ++nMismatches;
+                }
+            }
+
+            if (m_shouldRunCosmicRecoOption)
             {
-                PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+                PfoList serialHypothesis;
+                this->ProcessSlice(m_pSliceCRValidationWorkerInstance, sliceVector.at(iSlice), serialHypothesis);
+
+                if (!this->AreMatchingSliceHypotheses(crSliceHypotheses.at(iSlice), serialHypothesis))
+                {
+                    std::cout << "MasterAlgorithm: concurrent and serial cr hypotheses differ for slice " << iSlice << std::endl;
+                    ++nMismatches;
+                }
             }
         }
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "MasterAlgorithm: Exception during serial validation slice reconstruction " << statusCodeException.ToString() << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
 
-        ++sliceCounter;
+    if (m_printOverallRecoStatus || (nMismatches > 0))
+    {
+        std::cout << "MasterAlgorithm: concurrent slice reconstruction validation found " << nMismatches << " mismatched hypotheses in "
+                  << sliceVector.size() << " slice(s)" << std::endl;
     }
 
-    // ATTN: If we swapped these objects at the start, be sure to swap them back in case we ever want to use sliceVector
-    // after this function
-    if (!(m_shouldRunSlicing && !m_sliceSelectionToolVector.empty()))
-        sliceVector = std::move(selectedSliceVector);
+    return ((0 == nMismatches) ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE);
+}
 
-    if (m_shouldRunNeutrinoRecoOption && m_shouldRunCosmicRecoOption && (nuSliceHypotheses.size() != crSliceHypotheses.size()))
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool MasterAlgorithm::AreMatchingSliceHypotheses(const PfoList &sliceHypothesis1, const PfoList &sliceHypothesis2) const
+{
+    if (sliceHypothesis1.size() != sliceHypothesis2.size())
+        return false;
+
+    PfoList::const_iterator iter1(sliceHypothesis1.begin()), iter2(sliceHypothesis2.begin());
+
+    for (; iter1 != sliceHypothesis1.end(); ++iter1, ++iter2)
+    {
+        const ParticleFlowObject *const pPfo1(*iter1), *const pPfo2(*iter2);
+
+        if ((pPfo1->GetParticleId() != pPfo2->GetParticleId()) || (pPfo1->GetDaughterPfoList().size() != pPfo2->GetDaughterPfoList().size()) ||
+            (pPfo1->GetClusterList().size() != pPfo2->GetClusterList().size()) || (pPfo1->GetVertexList().size() != pPfo2->GetVertexList().size()))
+        {
+            return false;
+        }
+
+        VertexList::const_iterator vertexIter1(pPfo1->GetVertexList().begin()), vertexIter2(pPfo2->GetVertexList().begin());
+
+        for (; vertexIter1 != pPfo1->GetVertexList().end(); ++vertexIter1, ++vertexIter2)
+        {
+            if ((*vertexIter1)->GetPosition() != (*vertexIter2)->GetPosition())
+                return false;
+        }
+
+        // ATTN Worker instance hits are compared via the master instance hits from which they were copied
+        auto getParentAddresses = [](const ParticleFlowObject *const pPfo) {
+            std::vector<const void *> parentAddresses;
+
+            for (const Cluster *const pCluster : pPfo->GetClusterList())
+            {
+                CaloHitList caloHitList;
+                pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+                caloHitList.insert(caloHitList.end(), pCluster->GetIsolatedCaloHitList().begin(), pCluster->GetIsolatedCaloHitList().end());
+
+                for (const CaloHit *const pCaloHit : caloHitList)
+                    parentAddresses.push_back(pCaloHit->GetParentAddress());
+            }
+
+            std::sort(parentAddresses.begin(), parentAddresses.end());
+            return parentAddresses;
+        };
+
+        if (getParentAddresses(pPfo1) != getParentAddresses(pPfo2))
+            return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::SetSliceIndex(const PfoList &sliceHypothesis, const unsigned int sliceIndex) const
+{
+    for (const ParticleFlowObject *const pPfo : sliceHypothesis)
+    {
+        PandoraContentApi::ParticleFlowObject::Metadata metadata;
+        metadata.m_propertiesToAdd["SliceIndex"] = sliceIndex;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+    }
 
     return STATUS_CODE_SUCCESS;
 }
@@ -627,17 +1010,44 @@ StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuS
 
 StatusCode MasterAlgorithm::Reset()
 {
-    for (const Pandora *const pCRWorker : m_crWorkerInstances)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pCRWorker));
+    // ATTN Cosmic-ray worker instances may already have been reset in the background, during the previous event
+    if (!m_crWorkersAlreadyReset)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ResetWorkerInstances(m_crWorkerInstances, m_nCRWorkerThreads));
+
+    m_crWorkersAlreadyReset = false;
 
     if (m_pSlicingWorkerInstance)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSlicingWorkerInstance));
 
-    if (m_pSliceNuWorkerInstance)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceNuWorkerInstance));
+    for (const Pandora *const pSliceNuWorker : m_sliceNuWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceNuWorker));
+
+    for (const Pandora *const pSliceCRWorker : m_sliceCRWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceCRWorker));
+
+    if (m_pSliceNuValidationWorkerInstance)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceNuValidationWorkerInstance));
 
-    if (m_pSliceCRWorkerInstance)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceCRWorkerInstance));
+    if (m_pSliceCRValidationWorkerInstance)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceCRValidationWorkerInstance));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::ResetWorkerInstances(const PandoraInstanceList &workerInstances, const unsigned int nThreads) const
+{
+    try
+    {
+        LArThreadingHelper::ParallelFor(workerInstances.size(), nThreads, [&](const unsigned int iWorker) {
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*workerInstances.at(iWorker)));
+        });
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        return statusCodeException.GetStatusCode();
+    }
 
     return STATUS_CODE_SUCCESS;
 }
@@ -646,6 +1056,21 @@ StatusCode MasterAlgorithm::Reset()
 
 StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const CaloHit *const pCaloHit) const
 {
+    const auto startTime(m_printHitCopyStatistics ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point());
+    const HitCopyTable::HitToIndexMap::const_iterator iter(m_hitCopyTable.m_hitToIndexMap.find(pCaloHit));
+
+    if (m_hitCopyTable.m_hitToIndexMap.end() != iter)
+    {
+        const LArCaloHitParameters &parameters(m_hitCopyTable.m_parameters.at(iter->second));
+        const MCContributionVector &mcContributions(m_hitCopyTable.m_mcContributions.at(iter->second));
+        ++m_nTableHitCopies;
+
+        if (m_printHitCopyStatistics)
+            m_hitCopyTableLookupTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+        return this->Copy(pPandora, pCaloHit, parameters, mcContributions);
+    }
+
     const LArCaloHit *const pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
     if (pLArCaloHit == nullptr)
     {
@@ -654,27 +1079,51 @@ StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const CaloHit *c
     }
     LArCaloHitParameters parameters;
     pLArCaloHit->FillParameters(parameters);
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*pPandora, parameters, m_larCaloHitFactory));
 
+    MCContributionVector mcContributions;
     if (m_passMCParticlesToWorkerInstances)
-    {
-        MCParticleVector mcParticleVector;
-        for (const auto &weightMapEntry : pLArCaloHit->GetMCParticleWeightMap())
-            mcParticleVector.push_back(weightMapEntry.first);
-        std::sort(mcParticleVector.begin(), mcParticleVector.end(), LArMCParticleHelper::SortByMomentum);
+        this->GetMCContributions(pLArCaloHit, mcContributions);
 
-        for (const MCParticle *const pMCParticle : mcParticleVector)
-        {
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
-                PandoraApi::SetCaloHitToMCParticleRelationship(*pPandora, pLArCaloHit, pMCParticle, pLArCaloHit->GetMCParticleWeightMap().at(pMCParticle)));
-        }
+    return this->Copy(pPandora, pCaloHit, parameters, mcContributions);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::Copy(
+    const Pandora *const pPandora, const CaloHit *const pCaloHit, const LArCaloHitParameters &parameters, const MCContributionVector &mcContributions) const
+{
+    const auto startTime(m_printHitCopyStatistics ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*pPandora, parameters, m_larCaloHitFactory));
+
+    for (const MCContributionVector::value_type &mcContribution : mcContributions)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::SetCaloHitToMCParticleRelationship(*pPandora, pCaloHit, mcContribution.first, mcContribution.second));
     }
 
+    ++m_nHitCopies;
+
+    if (m_printHitCopyStatistics)
+        m_hitCopyTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void MasterAlgorithm::GetMCContributions(const LArCaloHit *const pLArCaloHit, MCContributionVector &mcContributions) const
+{
+    MCParticleVector mcParticleVector;
+    for (const auto &weightMapEntry : pLArCaloHit->GetMCParticleWeightMap())
+        mcParticleVector.push_back(weightMapEntry.first);
+    std::sort(mcParticleVector.begin(), mcParticleVector.end(), LArMCParticleHelper::SortByMomentum);
+
+    for (const MCParticle *const pMCParticle : mcParticleVector)
+        mcContributions.emplace_back(pMCParticle, pLArCaloHit->GetMCParticleWeightMap().at(pMCParticle));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const MCParticle *const pMCParticle, const LArMCParticleFactory *const pMCParticleFactory) const
 {
     const LArMCParticle *const pLArMCParticle = dynamic_cast<const LArMCParticle *>(pMCParticle);
@@ -1197,6 +1646,31 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
 
+    // ATTN Concurrent slice reconstruction is not guaranteed to reproduce the serial output (see RunConcurrentSliceReconstruction), so it
+    // is off unless more than one slice worker thread is explicitly requested
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSliceWorkerThreads", m_nSliceWorkerThreads));
+    m_nSliceWorkerThreads = LArThreadingHelper::GetNThreads(m_nSliceWorkerThreads);
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ValidateConcurrentSliceReconstruction", m_validateConcurrentSliceReconstruction));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NCRWorkerThreads", m_nCRWorkerThreads));
+    m_nCRWorkerThreads = LArThreadingHelper::GetNThreads(m_nCRWorkerThreads);
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PrintCRWorkerTimings", m_printCRWorkerTimings));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ShouldOverlapCRWorkerResets", m_shouldOverlapCRWorkerResets));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseHitCopyTable", m_useHitCopyTable));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PrintHitCopyStatistics", m_printHitCopyStatistics));
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "CRSettingsFile", m_crSettingsFile));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "NuSettingsFile", m_nuSettingsFile));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "SlicingSettingsFile", m_slicingSettingsFile));
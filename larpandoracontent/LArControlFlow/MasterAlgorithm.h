@@ -14,6 +14,7 @@
 #include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include <atomic>
 #include <unordered_map>
 
 namespace lar_content
@@ -93,6 +94,22 @@ protected:
 
     typedef std::map<unsigned int, LArTPCHitList> VolumeIdToHitListMap;
 
+    typedef std::vector<std::pair<const pandora::MCParticle *, float>> MCContributionVector;
+
+    /**
+     *  @brief  HitCopyTable class, an immutable per-event store of everything needed to copy each input hit into a worker instance.
+     *          Built once per event, then shared read-only by all copies, including those made from worker threads.
+     */
+    class HitCopyTable
+    {
+    public:
+        typedef std::unordered_map<const pandora::CaloHit *, unsigned int> HitToIndexMap;
+
+        HitToIndexMap m_hitToIndexMap;                       ///< The map from input hit to table index
+        std::vector<LArCaloHitParameters> m_parameters;      ///< The lar calo hit parameters, by table index
+        std::vector<MCContributionVector> m_mcContributions; ///< The mc contributions, sorted by mc particle momentum, by table index
+    };
+
     pandora::StatusCode Run();
 
     /**
@@ -105,6 +122,17 @@ protected:
      */
     pandora::StatusCode CopyMCParticles() const;
 
+    /**
+     *  @brief  Build the hit copy table for the hits in the named input list
+     */
+    pandora::StatusCode BuildHitCopyTable();
+
+    /**
+     *  @brief  Print the hit copy counters for the current event, with the measured saving from the hit copy table. The cost of
+     *          preparing a hit without the table is taken as the table build time per entry.
+     */
+    void PrintHitCopyStatistics() const;
+
     /**
      *  @brief  Get the mapping from lar tpc volume id to lists of all hits, and truncated hits
      *
@@ -113,7 +141,7 @@ protected:
     pandora::StatusCode GetVolumeIdToHitListMap(VolumeIdToHitListMap &volumeIdToHitListMap) const;
 
     /**
-     *  @brief  Run the cosmic-ray reconstruction worker instances
+     *  @brief  Run the cosmic-ray reconstruction worker instances, concurrently if configured to use more than one thread
      *
      *  @param  volumeIdToHitListMap the volume id to hit list map
      */
@@ -168,6 +196,65 @@ protected:
      */
     pandora::StatusCode RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const;
 
+    /**
+     *  @brief  Process the slices concurrently, using the pools of per-slice worker instances. Slice i is always processed by pool
+     *          member (i % pool size), so each worker instance sees its slices in slice order. Hypotheses are returned in slice order.
+     *
+     *          This mode is NOT equivalent to serial processing. Worker instances are not reset between slices, as the pfos of earlier
+     *          slices must survive until the selected pfos are recreated in the master instance. Under serial processing one worker
+     *          instance has seen every earlier slice before processing a slice, whereas a pool member has seen only the earlier slices
+     *          assigned to it, so the output may differ wherever a worker algorithm carries state across slices in an instance. The mode
+     *          is therefore off by default and only used if NSliceWorkerThreads is set above one. Whether a given configuration is
+     *          affected can be checked by enabling ValidateConcurrentSliceReconstruction, which reprocesses every slice serially.
+     *
+     *  @param  sliceVector the slice vector
+     *  @param  nuSliceHypotheses to receive the vector of slice neutrino hypotheses
+     *  @param  crSliceHypotheses to receive the vector of slice cosmic-ray hypotheses
+     */
+    pandora::StatusCode RunConcurrentSliceReconstruction(
+        const SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const;
+
+    /**
+     *  @brief  Copy the hits in a slice to a worker instance and process them, for use from within a worker thread
+     *
+     *  @param  pWorker the address of the worker instance
+     *  @param  sliceHits the slice hits
+     *  @param  sliceHypothesis to receive the list of pfos created by the worker instance for this slice
+     */
+    void ProcessSlice(const pandora::Pandora *const pWorker, const pandora::CaloHitList &sliceHits, pandora::PfoList &sliceHypothesis) const;
+
+    /**
+     *  @brief  Reprocess the slices serially, on the dedicated validation worker instances, and compare the resulting hypotheses with
+     *          those from the concurrent slice reconstruction
+     *
+     *  @param  sliceVector the slice vector
+     *  @param  nuSliceHypotheses the vector of slice neutrino hypotheses from the concurrent slice reconstruction
+     *  @param  crSliceHypotheses the vector of slice cosmic-ray hypotheses from the concurrent slice reconstruction
+     *
+     *  @return success if all hypotheses match, failure otherwise
+     */
+    pandora::StatusCode ValidateConcurrentSliceReconstruction(
+        const SliceVector &sliceVector, const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses) const;
+
+    /**
+     *  @brief  Whether two slice hypotheses, from different worker instances, match. The pfos must match in order, particle id, number
+     *          of daughters, vertex positions and the master instance hits in their clusters.
+     *
+     *  @param  sliceHypothesis1 the first slice hypothesis
+     *  @param  sliceHypothesis2 the second slice hypothesis
+     *
+     *  @return boolean
+     */
+    bool AreMatchingSliceHypotheses(const pandora::PfoList &sliceHypothesis1, const pandora::PfoList &sliceHypothesis2) const;
+
+    /**
+     *  @brief  Label each pfo in a slice hypothesis with the index of the slice
+     *
+     *  @param  sliceHypothesis the slice hypothesis
+     *  @param  sliceIndex the slice index
+     */
+    pandora::StatusCode SetSliceIndex(const pandora::PfoList &sliceHypothesis, const unsigned int sliceIndex) const;
+
     /**
      *  @brief  Examine slice hypotheses to identify the most appropriate to provide in final event output
      *
@@ -181,6 +268,16 @@ protected:
      */
     pandora::StatusCode Reset();
 
+    /**
+     *  @brief  Reset a list of worker instances, distributing the instances over a number of threads
+     *
+     *  @param  workerInstances the list of worker instances
+     *  @param  nThreads the number of threads to use
+     *
+     *  @return status code, that of the first failed reset if any
+     */
+    pandora::StatusCode ResetWorkerInstances(const PandoraInstanceList &workerInstances, const unsigned int nThreads) const;
+
     /**
      *  @brief  Copy a specified calo hit to the provided pandora instance
      *
@@ -189,6 +286,25 @@ protected:
      */
     pandora::StatusCode Copy(const pandora::Pandora *const pPandora, const pandora::CaloHit *const pCaloHit) const;
 
+    /**
+     *  @brief  Copy a specified calo hit to the provided pandora instance, using pre-filled parameters and mc contributions
+     *
+     *  @param  pPandora the address of the target pandora instance
+     *  @param  pCaloHit the address of the calo hit
+     *  @param  parameters the lar calo hit parameters
+     *  @param  mcContributions the mc contributions to the calo hit
+     */
+    pandora::StatusCode Copy(const pandora::Pandora *const pPandora, const pandora::CaloHit *const pCaloHit, const LArCaloHitParameters &parameters,
+        const MCContributionVector &mcContributions) const;
+
+    /**
+     *  @brief  Get the mc contributions to a specified lar calo hit, sorted by mc particle momentum
+     *
+     *  @param  pLArCaloHit the address of the lar calo hit
+     *  @param  mcContributions to receive the mc contributions
+     */
+    void GetMCContributions(const LArCaloHit *const pLArCaloHit, MCContributionVector &mcContributions) const;
+
     /**
      *  @brief  Copy a specified mc particle to the provided pandora instance
      *
@@ -326,6 +442,25 @@ protected:
     const pandora::Pandora *m_pSlicingWorkerInstance; ///< The slicing worker instance
     const pandora::Pandora *m_pSliceNuWorkerInstance; ///< The per-slice neutrino reconstruction worker instance
     const pandora::Pandora *m_pSliceCRWorkerInstance; ///< The per-slice cosmic-ray reconstruction worker instance
+    PandoraInstanceList m_sliceNuWorkerInstances;     ///< The pool of per-slice neutrino worker instances (first entry is m_pSliceNuWorkerInstance)
+    PandoraInstanceList m_sliceCRWorkerInstances;     ///< The pool of per-slice cosmic-ray worker instances (first entry is m_pSliceCRWorkerInstance)
+    bool m_validateConcurrentSliceReconstruction;     ///< Whether to reprocess concurrently reconstructed slices serially and compare the results
+    const pandora::Pandora *m_pSliceNuValidationWorkerInstance; ///< The serial per-slice neutrino worker instance used for validation
+    const pandora::Pandora *m_pSliceCRValidationWorkerInstance; ///< The serial per-slice cosmic-ray worker instance used for validation
+    unsigned int m_nSliceWorkerThreads;               ///< The number of slice reco threads and pool size per hypothesis (default 1, serial and exact)
+    unsigned int m_nCRWorkerThreads;                  ///< The number of threads across which to run the cosmic-ray worker instances
+    bool m_printCRWorkerTimings;                      ///< Whether to print the wall-clock time taken by each cosmic-ray worker instance
+    bool m_shouldOverlapCRWorkerResets;               ///< Whether to overlap the cosmic-ray worker reset with the later master stages
+    bool m_crWorkersAlreadyReset;                     ///< Whether the cosmic-ray workers were reset in the background during the last event
+
+    bool m_useHitCopyTable;                                    ///< Whether to copy hits to worker instances via the per-event hit copy table
+    bool m_printHitCopyStatistics;                             ///< Whether to print per-event hit copy counters
+    HitCopyTable m_hitCopyTable;                               ///< The per-event hit copy table
+    mutable std::atomic<unsigned int> m_nHitCopies;            ///< The number of hit copies made in the current event
+    mutable std::atomic<unsigned int> m_nTableHitCopies;       ///< The number of hit copies made via the hit copy table in the current event
+    mutable std::atomic<long long> m_hitCopyTimeNs;            ///< The time spent copying hits in the current event, summed over threads, in ns
+    long long m_hitCopyTableBuildTimeNs;                       ///< The time spent building the hit copy table in the current event, in ns
+    mutable std::atomic<long long> m_hitCopyTableLookupTimeNs; ///< The time spent looking up hits in the hit copy table, summed over threads, in ns
 
     bool m_fullWidthCRWorkerWireGaps;        ///< Whether wire-type line gaps in cosmic-ray worker instances should cover all drift time
     bool m_passMCParticlesToWorkerInstances; ///< Whether to pass mc particle details (and links to calo hits) to worker instances
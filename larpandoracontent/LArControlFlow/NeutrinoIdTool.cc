@@ -35,7 +35,8 @@ NeutrinoIdTool<T>::NeutrinoIdTool() :
     m_minProbability(0.0f),
     m_maxNeutrinos(1),
     m_persistFeatures(false),
-    m_filePathEnvironmentVariable("FW_SEARCH_PATH")
+    m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
+    m_featureMatrix(SliceFeatures::GetFeatureNames())
 {
 }
 
@@ -52,8 +53,9 @@ void NeutrinoIdTool<T>::SelectOutputPfos(const Algorithm *const pAlgorithm, cons
     if (nSlices == 0)
         return;
 
+    m_featureMatrix.Clear();
     SliceFeaturesVector sliceFeaturesVector;
-    this->GetSliceFeatures(this, nuSliceHypotheses, crSliceHypotheses, sliceFeaturesVector);
+    this->GetSliceFeatures(this, nuSliceHypotheses, crSliceHypotheses, m_featureMatrix, sliceFeaturesVector);
 
     if (m_useTrainingMode)
     {
@@ -85,10 +87,12 @@ void NeutrinoIdTool<T>::SelectOutputPfos(const Algorithm *const pAlgorithm, cons
 
 template <typename T>
 void NeutrinoIdTool<T>::GetSliceFeatures(const NeutrinoIdTool<T> *const pTool, const SliceHypotheses &nuSliceHypotheses,
-    const SliceHypotheses &crSliceHypotheses, SliceFeaturesVector &sliceFeaturesVector) const
+    const SliceHypotheses &crSliceHypotheses, MvaFeatureMatrix &featureMatrix, SliceFeaturesVector &sliceFeaturesVector) const
 {
+    sliceFeaturesVector.reserve(sliceFeaturesVector.size() + nuSliceHypotheses.size());
+
     for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
-        sliceFeaturesVector.push_back(SliceFeatures(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), pTool));
+        sliceFeaturesVector.push_back(SliceFeatures(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), pTool, featureMatrix));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -242,15 +246,53 @@ void NeutrinoIdTool<T>::SelectAllPfos(const pandora::Algorithm *const pAlgorithm
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void NeutrinoIdTool<T>::GetNeutrinoProbabilities(const SliceFeaturesVector &sliceFeaturesVector, FloatVector &nuProbabilities) const
+{
+    // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray
+    FloatVector probabilities(sliceFeaturesVector.size(), 0.f);
+    typename T::MvaFeatureVectorList featuresList;
+    std::vector<unsigned int> scoredSliceIndices;
+
+    for (unsigned int sliceIndex = 0, nSlices = sliceFeaturesVector.size(); sliceIndex < nSlices; ++sliceIndex)
+    {
+        const SliceFeatures &sliceFeatures(sliceFeaturesVector.at(sliceIndex));
+
+        if (!sliceFeatures.IsFeatureVectorAvailable())
+            continue;
+
+        LArMvaHelper::MvaFeatureVector featureVector;
+        sliceFeatures.GetFeatureVector(featureVector);
+        featuresList.push_back(featureVector);
+        scoredSliceIndices.push_back(sliceIndex);
+    }
+
+    if (!featuresList.empty())
+    {
+        typename T::ScoreVector featuresProbabilities;
+        m_mva.CalculateProbabilities(featuresList, featuresProbabilities);
+
+        for (unsigned int featuresIndex = 0, nFeatures = featuresList.size(); featuresIndex < nFeatures; ++featuresIndex)
+            probabilities.at(scoredSliceIndices.at(featuresIndex)) = static_cast<float>(featuresProbabilities.at(featuresIndex));
+    }
+
+    nuProbabilities.swap(probabilities);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void NeutrinoIdTool<T>::SelectPfosByProbability(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
     const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, PfoList &selectedPfos) const
 {
+    FloatVector nuProbabilities;
+    this->GetNeutrinoProbabilities(sliceFeaturesVector, nuProbabilities);
+
     // Calculate the probability of each slice that passes the minimum probability cut
     std::vector<UintFloatPair> sliceIndexProbabilityPairs;
     for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
     {
-        const float nuProbability(sliceFeaturesVector.at(sliceIndex).GetNeutrinoProbability(m_mva));
+        const float nuProbability(nuProbabilities.at(sliceIndex));
 
         for (const ParticleFlowObject *const pPfo : crSliceHypotheses.at(sliceIndex))
         {
@@ -327,8 +369,10 @@ void NeutrinoIdTool<T>::SelectPfos(const PfoList &pfos, PfoList &selectedPfos) c
 
 // TODO think about how to make this function cleaner when features are more established
 template <typename T>
-NeutrinoIdTool<T>::SliceFeatures::SliceFeatures(const PfoList &nuPfos, const PfoList &crPfos, const NeutrinoIdTool<T> *const pTool) :
-    m_isAvailable(false),
+NeutrinoIdTool<T>::SliceFeatures::SliceFeatures(
+    const PfoList &nuPfos, const PfoList &crPfos, const NeutrinoIdTool<T> *const pTool, MvaFeatureMatrix &featureMatrix) :
+    m_pFeatureMatrix(&featureMatrix),
+    m_row(featureMatrix.AddRow()),
     m_pTool(pTool)
 {
     try
@@ -413,30 +457,20 @@ NeutrinoIdTool<T>::SliceFeatures::SliceFeatures(const PfoList &nuPfos, const Pfo
 
         const float crFracHitsInLongestTrack = static_cast<float>(nCRHitsMax) / static_cast<float>(nCRHitsTotal);
 
-        // Push the features to the feature vector
-        m_featureVector.push_back(nuNFinalStatePfos);
-        m_featureVector.push_back(nuNHitsTotal);
-        m_featureVector.push_back(nuVertexY);
-        m_featureVector.push_back(nuWeightedDirZ);
-        m_featureVector.push_back(nuNSpacePointsInSphere);
-        m_featureVector.push_back(nuEigenRatioInSphere);
-        m_featureVector.push_back(crLongestTrackDirY);
-        m_featureVector.push_back(crLongestTrackDeflection);
-        m_featureVector.push_back(crFracHitsInLongestTrack);
-        m_featureVector.push_back(nCRHitsMax);
-
-        m_featureMap["NuNFinalStatePfos"] = nuNFinalStatePfos;
-        m_featureMap["NuNHitsTotal"] = nuNHitsTotal;
-        m_featureMap["NuVertexY"] = nuVertexY;
-        m_featureMap["NuWeightedDirZ"] = nuWeightedDirZ;
-        m_featureMap["NuNSpacePointsInSphere"] = nuNSpacePointsInSphere;
-        m_featureMap["NuEigenRatioInSphere"] = nuEigenRatioInSphere;
-        m_featureMap["CRLongestTrackDirY"] = crLongestTrackDirY;
-        m_featureMap["CRLongestTrackDeflection"] = crLongestTrackDeflection;
-        m_featureMap["CRFracHitsInLongestTrack"] = crFracHitsInLongestTrack;
-        m_featureMap["CRNHitsMax"] = nCRHitsMax;
-
-        m_isAvailable = true;
+        // Fill the features into their named columns only once every feature is calculated, so that the row is either wholly valid or invalid
+        const FeatureColumns &featureColumns(pTool->m_featureColumns);
+        LArMvaHelper::MvaFeatureVector featureVector(featureMatrix.GetNFeatures());
+        featureVector.at(featureColumns.m_nuNFinalStatePfos) = nuNFinalStatePfos;
+        featureVector.at(featureColumns.m_nuNHitsTotal) = nuNHitsTotal;
+        featureVector.at(featureColumns.m_nuVertexY) = nuVertexY;
+        featureVector.at(featureColumns.m_nuWeightedDirZ) = nuWeightedDirZ;
+        featureVector.at(featureColumns.m_nuNSpacePointsInSphere) = nuNSpacePointsInSphere;
+        featureVector.at(featureColumns.m_nuEigenRatioInSphere) = nuEigenRatioInSphere;
+        featureVector.at(featureColumns.m_crLongestTrackDirY) = crLongestTrackDirY;
+        featureVector.at(featureColumns.m_crLongestTrackDeflection) = crLongestTrackDeflection;
+        featureVector.at(featureColumns.m_crFracHitsInLongestTrack) = crFracHitsInLongestTrack;
+        featureVector.at(featureColumns.m_nCRHitsMax) = nCRHitsMax;
+        featureMatrix.SetFeatures(m_row, featureVector);
     }
     catch (StatusCodeException &)
     {
@@ -447,45 +481,43 @@ NeutrinoIdTool<T>::SliceFeatures::SliceFeatures(const PfoList &nuPfos, const Pfo
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-bool NeutrinoIdTool<T>::SliceFeatures::IsFeatureVectorAvailable() const
+StringVector NeutrinoIdTool<T>::SliceFeatures::GetFeatureNames()
 {
-    return m_isAvailable;
+    return {"NuNFinalStatePfos", "NuNHitsTotal", "NuVertexY", "NuWeightedDirZ", "NuNSpacePointsInSphere", "NuEigenRatioInSphere",
+        "CRLongestTrackDirY", "CRLongestTrackDeflection", "CRFracHitsInLongestTrack", "CRNHitsMax"};
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-void NeutrinoIdTool<T>::SliceFeatures::GetFeatureVector(LArMvaHelper::MvaFeatureVector &featureVector) const
+bool NeutrinoIdTool<T>::SliceFeatures::IsFeatureVectorAvailable() const
 {
-    if (!m_isAvailable)
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-
-    featureVector.insert(featureVector.end(), m_featureVector.begin(), m_featureVector.end());
+    return m_pFeatureMatrix->IsRowValid(m_row);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-void NeutrinoIdTool<T>::SliceFeatures::GetFeatureMap(LArMvaHelper::MvaFeatureMap &featureMap) const
+void NeutrinoIdTool<T>::SliceFeatures::GetFeatureVector(LArMvaHelper::MvaFeatureVector &featureVector) const
 {
-    if (!m_isAvailable)
+    if (!this->IsFeatureVectorAvailable())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    featureMap.insert(m_featureMap.begin(), m_featureMap.end());
+    m_pFeatureMatrix->GetFeatureVector(m_row, featureVector);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-float NeutrinoIdTool<T>::SliceFeatures::GetNeutrinoProbability(const T &t) const
+void NeutrinoIdTool<T>::SliceFeatures::GetFeatureMap(LArMvaHelper::MvaFeatureMap &featureMap) const
 {
-    // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray
     if (!this->IsFeatureVectorAvailable())
-        return 0.f;
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    const StringVector &featureNames(m_pFeatureMatrix->GetFeatureNames());
 
-    LArMvaHelper::MvaFeatureVector featureVector;
-    this->GetFeatureVector(featureVector);
-    return LArMvaHelper::CalculateProbability(t, featureVector);
+    for (unsigned int featureIndex = 0, nFeatures = featureNames.size(); featureIndex < nFeatures; ++featureIndex)
+        featureMap[featureNames.at(featureIndex)] = m_pFeatureMatrix->GetFeature(m_row, featureIndex);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -589,6 +621,24 @@ void NeutrinoIdTool<T>::SliceFeatures::GetPointsInSphere(const CartesianPointVec
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+NeutrinoIdTool<T>::FeatureColumns::FeatureColumns() :
+    m_nuNFinalStatePfos(std::numeric_limits<unsigned int>::max()),
+    m_nuNHitsTotal(std::numeric_limits<unsigned int>::max()),
+    m_nuVertexY(std::numeric_limits<unsigned int>::max()),
+    m_nuWeightedDirZ(std::numeric_limits<unsigned int>::max()),
+    m_nuNSpacePointsInSphere(std::numeric_limits<unsigned int>::max()),
+    m_nuEigenRatioInSphere(std::numeric_limits<unsigned int>::max()),
+    m_crLongestTrackDirY(std::numeric_limits<unsigned int>::max()),
+    m_crLongestTrackDeflection(std::numeric_limits<unsigned int>::max()),
+    m_crFracHitsInLongestTrack(std::numeric_limits<unsigned int>::max()),
+    m_nCRHitsMax(std::numeric_limits<unsigned int>::max())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode NeutrinoIdTool<T>::ReadSettings(const TiXmlHandle xmlHandle)
 {
@@ -634,6 +684,26 @@ StatusCode NeutrinoIdTool<T>::ReadSettings(const TiXmlHandle xmlHandle)
         m_mva.Initialize(fullMvaFileName, mvaName);
     }
 
+    // ATTN Resolve the feature matrix columns by name once, rather than for every slice
+    try
+    {
+        m_featureColumns.m_nuNFinalStatePfos = m_featureMatrix.GetFeatureIndex("NuNFinalStatePfos");
+        m_featureColumns.m_nuNHitsTotal = m_featureMatrix.GetFeatureIndex("NuNHitsTotal");
+        m_featureColumns.m_nuVertexY = m_featureMatrix.GetFeatureIndex("NuVertexY");
+        m_featureColumns.m_nuWeightedDirZ = m_featureMatrix.GetFeatureIndex("NuWeightedDirZ");
+        m_featureColumns.m_nuNSpacePointsInSphere = m_featureMatrix.GetFeatureIndex("NuNSpacePointsInSphere");
+        m_featureColumns.m_nuEigenRatioInSphere = m_featureMatrix.GetFeatureIndex("NuEigenRatioInSphere");
+        m_featureColumns.m_crLongestTrackDirY = m_featureMatrix.GetFeatureIndex("CRLongestTrackDirY");
+        m_featureColumns.m_crLongestTrackDeflection = m_featureMatrix.GetFeatureIndex("CRLongestTrackDeflection");
+        m_featureColumns.m_crFracHitsInLongestTrack = m_featureMatrix.GetFeatureIndex("CRFracHitsInLongestTrack");
+        m_featureColumns.m_nCRHitsMax = m_featureMatrix.GetFeatureIndex("CRNHitsMax");
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "NeutrinoIdTool::ReadSettings - unable to resolve the feature matrix columns" << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
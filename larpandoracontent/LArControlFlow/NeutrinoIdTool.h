@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
 
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+#include "larpandoracontent/LArObjects/LArMvaFeatureMatrix.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 
 #include <functional>
@@ -53,8 +54,17 @@ private:
          *  @param  nuPfos input list of Pfos reconstructed under the neutrino hypothesis
          *  @param  crPfos input list of Pfos reconstructed under the cosmic ray hypothesis
          *  @param  pTool address of the tool using this class
+         *  @param  featureMatrix the feature matrix, to which a row holding the features of this slice is added
          */
-        SliceFeatures(const pandora::PfoList &nuPfos, const pandora::PfoList &crPfos, const NeutrinoIdTool *const pTool);
+        SliceFeatures(const pandora::PfoList &nuPfos, const pandora::PfoList &crPfos, const NeutrinoIdTool *const pTool,
+            MvaFeatureMatrix &featureMatrix);
+
+        /**
+         *  @brief  Get the ordered names of the features, defining the columns of the feature matrix
+         *
+         *  @return the feature names
+         */
+        static pandora::StringVector GetFeatureNames();
 
         /**
          *  @brief  Check if all features were calculable
@@ -77,15 +87,6 @@ private:
          */
         void GetFeatureMap(LArMvaHelper::MvaFeatureMap &featureMap) const;
 
-        /**
-         *  @brief  Get the probability that this slice contains a neutrino interaction
-         *
-         *  @param  t the MVA used to calculate the probability
-         *
-         *  @return the probability that the slice contains a neutrino interaction
-         */
-        float GetNeutrinoProbability(const T &t) const;
-
     private:
         /**
          *  @brief  Get the recontructed neutrino the input list of neutrino Pfos
@@ -152,12 +153,34 @@ private:
         void GetPointsInSphere(const pandora::CartesianPointVector &spacePoints, const pandora::CartesianVector &vertex, const float radius,
             pandora::CartesianPointVector &spacePointsInSphere) const;
 
-        bool m_isAvailable;                             ///< Is the feature vector available
-        LArMvaHelper::MvaFeatureVector m_featureVector; ///< The MVA feature vector
-        LArMvaHelper::MvaFeatureMap m_featureMap;       ///< A map between MVA features and their names
+        const MvaFeatureMatrix *const m_pFeatureMatrix; ///< The feature matrix holding the features of all slices
+        const unsigned int m_row;                       ///< The row of the feature matrix holding the features of this slice
         const NeutrinoIdTool *const m_pTool;            ///< The tool that owns this
     };
 
+    /**
+     *  @brief  FeatureColumns class, holding the feature matrix column of each named slice feature
+     */
+    class FeatureColumns
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        FeatureColumns();
+
+        unsigned int m_nuNFinalStatePfos;        ///< The column of the number of neutrino final state pfos
+        unsigned int m_nuNHitsTotal;             ///< The column of the total number of neutrino hits
+        unsigned int m_nuVertexY;                ///< The column of the neutrino vertex y position
+        unsigned int m_nuWeightedDirZ;           ///< The column of the hit-weighted neutrino direction z component
+        unsigned int m_nuNSpacePointsInSphere;   ///< The column of the number of neutrino space points near the vertex
+        unsigned int m_nuEigenRatioInSphere;     ///< The column of the neutrino eigenvalue ratio near the vertex
+        unsigned int m_crLongestTrackDirY;       ///< The column of the longest cosmic-ray track direction y component
+        unsigned int m_crLongestTrackDeflection; ///< The column of the longest cosmic-ray track deflection
+        unsigned int m_crFracHitsInLongestTrack; ///< The column of the fraction of cosmic-ray hits in the longest track
+        unsigned int m_nCRHitsMax;               ///< The column of the number of hits in the longest cosmic-ray track
+    };
+
     typedef std::pair<unsigned int, float> UintFloatPair;
     typedef std::vector<SliceFeatures> SliceFeaturesVector;
 
@@ -167,10 +190,11 @@ private:
      *  @param  pTool the address of the this NeutrinoId tool
      *  @param  nuSliceHypotheses the input neutrino slice hypotheses
      *  @param  crSliceHypotheses the input cosmic slice hypotheses
+     *  @param  featureMatrix the feature matrix to receive the features of each slice
      *  @param  sliceFeaturesVector vector to hold the slice features
      */
-    void GetSliceFeatures(const NeutrinoIdTool *const pTool, const SliceHypotheses &nuSliceHypotheses,
-        const SliceHypotheses &crSliceHypotheses, SliceFeaturesVector &sliceFeaturesVector) const;
+    void GetSliceFeatures(const NeutrinoIdTool *const pTool, const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses,
+        MvaFeatureMatrix &featureMatrix, SliceFeaturesVector &sliceFeaturesVector) const;
 
     /**
      *  @brief  Get the slice with the most neutrino induced hits using Monte-Carlo information
@@ -233,6 +257,14 @@ private:
      */
     void SelectAllPfos(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &hypotheses, pandora::PfoList &selectedPfos) const;
 
+    /**
+     *  @brief  Get the probability that each slice contains a neutrino interaction, scoring all the slices in a single batch
+     *
+     *  @param  sliceFeaturesVector vector holding the slice features
+     *  @param  nuProbabilities to receive the neutrino probabilities, in the order of the slice features
+     */
+    void GetNeutrinoProbabilities(const SliceFeaturesVector &sliceFeaturesVector, pandora::FloatVector &nuProbabilities) const;
+
     /**
      *  @brief  Select pfos based on the probability that their slice contains a neutrino interaction
      *
@@ -271,6 +303,8 @@ private:
 
     T m_mva;                                   ///< The mva
     std::string m_filePathEnvironmentVariable; ///< The environment variable providing a list of paths to mva files
+    MvaFeatureMatrix m_featureMatrix;          ///< The features of the slices in the current event, reused between events
+    FeatureColumns m_featureColumns;           ///< The feature matrix column of each named slice feature, resolved in ReadSettings
 };
 
 typedef NeutrinoIdTool<AdaBoostDecisionTree> BdtNeutrinoIdTool;
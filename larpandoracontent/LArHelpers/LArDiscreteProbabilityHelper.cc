@@ -16,23 +16,16 @@ template <typename T>
 float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
     const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations)
 {
-    if (1 > nPermutations)
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-
-    const float rNominal(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(t1, t2));
-
-    unsigned int nExtreme(0);
-    for (unsigned int iPermutation = 0; iPermutation < nPermutations; ++iPermutation)
-    {
-        const float rRandomised(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(
-            LArDiscreteProbabilityHelper::MakeRandomisedSample(t1, randomNumberGenerator),
-            LArDiscreteProbabilityHelper::MakeRandomisedSample(t2, randomNumberGenerator)));
+    return LArDiscreteProbabilityHelper::RunPermutationTest(t1, t2, randomNumberGenerator, nPermutations, nullptr);
+}
 
-        if ((rRandomised - rNominal) > std::numeric_limits<float>::epsilon())
-            nExtreme++;
-    }
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    return static_cast<float>(nExtreme) / static_cast<float>(nPermutations);
+template <typename T>
+float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+    const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations, const PValueDecisionFunction &decisionFunction)
+{
+    return LArDiscreteProbabilityHelper::RunPermutationTest(t1, t2, randomNumberGenerator, nPermutations, &decisionFunction);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -124,10 +117,143 @@ float LArDiscreteProbabilityHelper::CalculateMean(const T &t)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+float LArDiscreteProbabilityHelper::RunPermutationTest(const T &t1, const T &t2, std::mt19937 &randomNumberGenerator,
+    const unsigned int nPermutations, const PValueDecisionFunction *const pDecisionFunction)
+{
+    if (1 > nPermutations)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    const float rNominal(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(t1, t2));
+    const unsigned int size(LArDiscreteProbabilityHelper::GetSize(t1));
+
+    pandora::FloatVector originalValues1(size), originalValues2(size);
+    for (unsigned int iElement = 0; iElement < size; ++iElement)
+    {
+        originalValues1[iElement] = LArDiscreteProbabilityHelper::GetElement(t1, iElement);
+        originalValues2[iElement] = LArDiscreteProbabilityHelper::GetElement(t2, iElement);
+    }
+
+    // ATTN Permuted datasets are stored element-major, so that each sum below is accumulated in element order, exactly as for a single
+    // dataset, while the innermost loops over the permutations in a block are independent and can be vectorised
+    const unsigned int blockSize(8);
+    pandora::FloatVector values1(size), values2(size), block1(size * blockSize, 0.f), block2(size * blockSize, 0.f);
+    float mean1[blockSize], mean2[blockSize], variance1[blockSize], variance2[blockSize], covariance[blockSize];
+
+    unsigned int nExtreme(0);
+    for (unsigned int iFirstPermutation = 0; iFirstPermutation < nPermutations; iFirstPermutation += blockSize)
+    {
+        const unsigned int nBlockPermutations(std::min(blockSize, nPermutations - iFirstPermutation));
+
+        // ATTN If the test ends part way through a block, the generator is rewound to leave it as if only the permutations up to that
+        // point had been drawn, as when each permutation was drawn and tested in turn
+        const std::mt19937 blockStartGenerator(randomNumberGenerator);
+        const auto rewindGenerator = [&](const unsigned int nUsedPermutations) {
+            randomNumberGenerator = blockStartGenerator;
+
+            for (unsigned int iBlock = 0; iBlock < nUsedPermutations; ++iBlock)
+                LArDiscreteProbabilityHelper::ShufflePermutation(originalValues1, originalValues2, randomNumberGenerator, values1, values2);
+        };
+
+        for (unsigned int iBlock = 0; iBlock < nBlockPermutations; ++iBlock)
+        {
+            LArDiscreteProbabilityHelper::ShufflePermutation(originalValues1, originalValues2, randomNumberGenerator, values1, values2);
+
+            for (unsigned int iElement = 0; iElement < size; ++iElement)
+            {
+                block1[iElement * blockSize + iBlock] = values1[iElement];
+                block2[iElement * blockSize + iBlock] = values2[iElement];
+            }
+        }
+
+        for (unsigned int iBlock = 0; iBlock < blockSize; ++iBlock)
+        {
+            mean1[iBlock] = 0.f;
+            mean2[iBlock] = 0.f;
+            variance1[iBlock] = 0.f;
+            variance2[iBlock] = 0.f;
+            covariance[iBlock] = 0.f;
+        }
+
+        for (unsigned int iElement = 0; iElement < size; ++iElement)
+        {
+            const float *const pElement1(block1.data() + iElement * blockSize);
+            const float *const pElement2(block2.data() + iElement * blockSize);
+
+            for (unsigned int iBlock = 0; iBlock < blockSize; ++iBlock)
+            {
+                mean1[iBlock] += pElement1[iBlock];
+                mean2[iBlock] += pElement2[iBlock];
+            }
+        }
+
+        for (unsigned int iBlock = 0; iBlock < blockSize; ++iBlock)
+        {
+            mean1[iBlock] /= static_cast<float>(size);
+            mean2[iBlock] /= static_cast<float>(size);
+        }
+
+        for (unsigned int iElement = 0; iElement < size; ++iElement)
+        {
+            const float *const pElement1(block1.data() + iElement * blockSize);
+            const float *const pElement2(block2.data() + iElement * blockSize);
+
+            for (unsigned int iBlock = 0; iBlock < blockSize; ++iBlock)
+            {
+                const float diff1(pElement1[iBlock] - mean1[iBlock]);
+                const float diff2(pElement2[iBlock] - mean2[iBlock]);
+
+                variance1[iBlock] += diff1 * diff1;
+                variance2[iBlock] += diff2 * diff2;
+                covariance[iBlock] += diff1 * diff2;
+            }
+        }
+
+        for (unsigned int iBlock = 0; iBlock < nBlockPermutations; ++iBlock)
+        {
+            const float sqrtVars(std::sqrt(variance1[iBlock] * variance2[iBlock]));
+
+            if (variance1[iBlock] < std::numeric_limits<float>::epsilon() || variance2[iBlock] < std::numeric_limits<float>::epsilon() ||
+                sqrtVars < std::numeric_limits<float>::epsilon())
+            {
+                rewindGenerator(iBlock + 1);
+                throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+            }
+
+            const float rRandomised(covariance[iBlock] / sqrtVars);
+
+            if ((rRandomised - rNominal) > std::numeric_limits<float>::epsilon())
+                nExtreme++;
+
+            if (pDecisionFunction)
+            {
+                // Stop once the remaining permutations can no longer change the decision, which is monotonic in the p-value
+                const unsigned int nRemaining(nPermutations - (iFirstPermutation + iBlock + 1));
+                const float minPValue(static_cast<float>(nExtreme) / static_cast<float>(nPermutations));
+                const float maxPValue(static_cast<float>(nExtreme + nRemaining) / static_cast<float>(nPermutations));
+
+                if ((nRemaining > 0) && ((*pDecisionFunction)(minPValue) == (*pDecisionFunction)(maxPValue)))
+                {
+                    rewindGenerator(iBlock + 1);
+                    return minPValue;
+                }
+            }
+        }
+    }
+
+    return static_cast<float>(nExtreme) / static_cast<float>(nPermutations);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
     const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, std::mt19937 &, const unsigned int);
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
     const pandora::FloatVector &, const pandora::FloatVector &, std::mt19937 &, const unsigned int);
+template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+    const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, std::mt19937 &, const unsigned int, const PValueDecisionFunction &);
+template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+    const pandora::FloatVector &, const pandora::FloatVector &, std::mt19937 &, const unsigned int, const PValueDecisionFunction &);
 
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromStudentTDistribution(
     const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, const unsigned int, const float);
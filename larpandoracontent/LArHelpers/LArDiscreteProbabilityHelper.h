@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArObjects/LArDiscreteProbabilityVector.h"
 
 #include <algorithm>
+#include <functional>
 #include <random>
 
 namespace lar_content
@@ -22,8 +23,11 @@ namespace lar_content
 class LArDiscreteProbabilityHelper
 {
 public:
+    typedef std::function<bool(const float)> PValueDecisionFunction;
+
     /**
-     *  @brief  Calculate P value for measured correlation coefficient between two datasets via a permutation test 
+     *  @brief  Calculate P value for measured correlation coefficient between two datasets via a permutation test. For each permutation,
+     *          the second dataset is shuffled before the first.
      *
      *  @param  t1 the first input dataset
      *  @param  t2 the second input dataset
@@ -36,6 +40,24 @@ public:
     static float CalculateCorrelationCoefficientPValueFromPermutationTest(
         const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations);
 
+    /**
+     *  @brief  Calculate P value for measured correlation coefficient between two datasets via a permutation test, stopping as soon as
+     *          the remaining permutations can no longer change a decision made on the p-value. The decision function must be monotonic
+     *          in the p-value. The returned p-value is then only guaranteed to give the same decision as the p-value from the full set
+     *          of permutations. The random number generator is left as if only the permutations that were run had been drawn.
+     *
+     *  @param  t1 the first input dataset
+     *  @param  t2 the second input dataset
+     *  @param  randomNumberGenerator the random number generator to shuffle the datasets
+     *  @param  nPermutations the maximum number of permutations to run
+     *  @param  decisionFunction the decision made on the p-value
+     *
+     *  @return the p-value
+     */
+    template <typename T>
+    static float CalculateCorrelationCoefficientPValueFromPermutationTest(const T &t1, const T &t2, std::mt19937 &randomNumberGenerator,
+        const unsigned int nPermutations, const PValueDecisionFunction &decisionFunction);
+
     /**
      *  @brief  Calculate P value for measured correlation coefficient between two datasets via a integrating the student T dist.
      *
@@ -73,26 +95,33 @@ public:
 
 private:
     /**
-     *  @brief  Make a randomised copy of a dataset
+     *  @brief  Run a permutation test for the correlation coefficient between two datasets. The datasets are copied once into flat
+     *          buffers, and each permutation shuffles a fresh copy of these in place. The correlation coefficients for a block of
+     *          permutations are evaluated together, with the innermost loops running over the independent permutations in the block.
      *
-     *  @param  t the dataset to be shuffled
-     *  @param  randomNumberGenerator the random number generator
+     *  @param  t1 the first input dataset
+     *  @param  t2 the second input dataset
+     *  @param  randomNumberGenerator the random number generator to shuffle the datasets
+     *  @param  nPermutations the (maximum) number of permutations to run
+     *  @param  pDecisionFunction address of the decision made on the p-value, used to stop early, or nullptr to run all permutations
      *
-     *  @return the reshuffled dataset
+     *  @return the p-value
      */
     template <typename T>
-    static T MakeRandomisedSample(const T &t, std::mt19937 &randomNumberGenerator);
+    static float RunPermutationTest(const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations,
+        const PValueDecisionFunction *const pDecisionFunction);
 
     /**
-     *  @brief  Make a randomised copy of dataset (dataset is an std::vector)
+     *  @brief  Draw a single permutation of two datasets, shuffling the second dataset and then the first
      *
-     *  @param  t the std::vector-based dataset to be shuffled
-     *  @param  randomNumberGenerator the random number generator
-     *
-     *  @return the reshuffled std::vector
+     *  @param  originalValues1 the first original dataset
+     *  @param  originalValues2 the second original dataset
+     *  @param  randomNumberGenerator the random number generator to shuffle the datasets
+     *  @param  values1 to receive the permuted first dataset
+     *  @param  values2 to receive the permuted second dataset
      */
-    template <typename T>
-    static std::vector<T> MakeRandomisedSample(const std::vector<T> &t, std::mt19937 &randomNumberGenerator);
+    static void ShufflePermutation(const pandora::FloatVector &originalValues1, const pandora::FloatVector &originalValues2,
+        std::mt19937 &randomNumberGenerator, pandora::FloatVector &values1, pandora::FloatVector &values2);
 
     /**
      *  @brief  Get the size the size of a dataset
@@ -139,19 +168,16 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template <typename T>
-inline std::vector<T> LArDiscreteProbabilityHelper::MakeRandomisedSample(const std::vector<T> &t, std::mt19937 &randomNumberGenerator)
+inline void LArDiscreteProbabilityHelper::ShufflePermutation(const pandora::FloatVector &originalValues1,
+    const pandora::FloatVector &originalValues2, std::mt19937 &randomNumberGenerator, pandora::FloatVector &values1, pandora::FloatVector &values2)
 {
-    std::vector<T> randomisedVector(t);
-    std::shuffle(randomisedVector.begin(), randomisedVector.end(), randomNumberGenerator);
-
-    return randomisedVector;
-}
+    std::copy(originalValues1.begin(), originalValues1.end(), values1.begin());
+    std::copy(originalValues2.begin(), originalValues2.end(), values2.begin());
 
-template <>
-inline DiscreteProbabilityVector LArDiscreteProbabilityHelper::MakeRandomisedSample(const DiscreteProbabilityVector &t, std::mt19937 &randomNumberGenerator)
-{
-    return DiscreteProbabilityVector(t, randomNumberGenerator);
+    // ATTN The second dataset is shuffled before the first. This order is part of the defined behaviour: for a given generator state,
+    // it fixes both the p-value and the generator state left behind
+    std::shuffle(values2.begin(), values2.end(), randomNumberGenerator);
+    std::shuffle(values1.begin(), values1.end(), randomNumberGenerator);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
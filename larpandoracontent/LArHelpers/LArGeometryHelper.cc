@@ -21,6 +21,8 @@
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
 #include "Plugins/LArTransformationPlugin.h"
 
 using namespace pandora;
@@ -320,6 +322,41 @@ void LArGeometryHelper::MergeThreePositions3D(const Pandora &pandora, const HitT
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArGeometryHelper::GetMinChiSquaredYZ(const Pandora &pandora, const DoubleVector &u, const DoubleVector &v, const DoubleVector &w,
+    const DoubleVector &sigmaU, const DoubleVector &sigmaV, const DoubleVector &sigmaW, const DoubleVector &uFit, const DoubleVector &vFit,
+    const DoubleVector &wFit, const double sigmaFit, DoubleVector &y, DoubleVector &z, DoubleVector &chiSquared)
+{
+    const std::size_t nPoints(u.size());
+
+    if ((v.size() != nPoints) || (w.size() != nPoints) || (sigmaU.size() != nPoints) || (sigmaV.size() != nPoints) ||
+        (sigmaW.size() != nPoints) || (uFit.size() != nPoints) || (vFit.size() != nPoints) || (wFit.size() != nPoints))
+    {
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+
+    y.resize(nPoints);
+    z.resize(nPoints);
+    chiSquared.resize(nPoints);
+
+    const LArTransformationPlugin *const pTransformationPlugin(pandora.GetPlugins()->GetLArTransformationPlugin());
+    const LArRotationalTransformationPlugin *const pRotationalPlugin(dynamic_cast<const LArRotationalTransformationPlugin *>(pTransformationPlugin));
+
+    if (pRotationalPlugin)
+    {
+        pRotationalPlugin->GetMinChiSquaredYZ(nPoints, u.data(), v.data(), w.data(), sigmaU.data(), sigmaV.data(), sigmaW.data(), uFit.data(),
+            vFit.data(), wFit.data(), sigmaFit, y.data(), z.data(), chiSquared.data());
+        return;
+    }
+
+    for (std::size_t iPoint = 0; iPoint < nPoints; ++iPoint)
+    {
+        pTransformationPlugin->GetMinChiSquaredYZ(u.at(iPoint), v.at(iPoint), w.at(iPoint), sigmaU.at(iPoint), sigmaV.at(iPoint), sigmaW.at(iPoint),
+            uFit.at(iPoint), vFit.at(iPoint), wFit.at(iPoint), sigmaFit, y.at(iPoint), z.at(iPoint), chiSquared.at(iPoint));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 CartesianVector LArGeometryHelper::ProjectPosition(const Pandora &pandora, const CartesianVector &position3D, const HitType view)
 {
     if (view == TPC_VIEW_U)
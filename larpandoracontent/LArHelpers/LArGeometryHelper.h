@@ -13,6 +13,7 @@
 #include "Pandora/StatusCodes.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace pandora
 {
@@ -34,6 +35,7 @@ class LArGeometryHelper
 {
 public:
     typedef std::set<unsigned int> UIntSet;
+    typedef std::vector<double> DoubleVector;
 
     /**
      *  @brief  Merge two views (U,V) to give a third view (Z).
@@ -157,6 +159,29 @@ public:
         const pandora::HitType view3, const pandora::CartesianVector &position1, const pandora::CartesianVector &position2,
         const pandora::CartesianVector &position3, pandora::CartesianVector &position3D, float &chiSquared);
 
+    /**
+     *  @brief  Get the y and z positions that minimise the chi-squared for a batch of (u, v, w) points, held in structure-of-arrays form,
+     *          avoiding a virtual call per point where the transformation plugin supports batch calculation
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  u the u values
+     *  @param  v the v values
+     *  @param  w the w values
+     *  @param  sigmaU the u uncertainties
+     *  @param  sigmaV the v uncertainties
+     *  @param  sigmaW the w uncertainties
+     *  @param  uFit the fit u values
+     *  @param  vFit the fit v values
+     *  @param  wFit the fit w values
+     *  @param  sigmaFit the fit uncertainty, common to all points
+     *  @param  y to receive the y values
+     *  @param  z to receive the z values
+     *  @param  chiSquared to receive the chi-squared values
+     */
+    static void GetMinChiSquaredYZ(const pandora::Pandora &pandora, const DoubleVector &u, const DoubleVector &v, const DoubleVector &w,
+        const DoubleVector &sigmaU, const DoubleVector &sigmaV, const DoubleVector &sigmaW, const DoubleVector &uFit, const DoubleVector &vFit,
+        const DoubleVector &wFit, const double sigmaFit, DoubleVector &y, DoubleVector &z, DoubleVector &chiSquared);
+
     /**
      *  @brief  Project 3D position into a given 2D view
      *
@@ -11,6 +11,8 @@
 
 #include "larpandoracontent/LArHelpers/LArHierarchyHelper.h"
 
+#include "larpandoracontent/LArObjects/LArHitSharingIndex.h"
+
 #include <numeric>
 
 namespace lar_content
@@ -1004,6 +1006,7 @@ LArHierarchyHelper::MCMatches::MCMatches(const MCHierarchy::Node *pMCParticle) :
 
 void LArHierarchyHelper::MCMatches::AddRecoMatch(const RecoHierarchy::Node *pReco, const int nSharedHits)
 {
+    m_recoNodeToIndexMap.emplace(pReco, m_recoNodes.size());
     m_recoNodes.emplace_back(pReco);
     m_sharedHits.emplace_back(nSharedHits);
 }
@@ -1012,20 +1015,18 @@ void LArHierarchyHelper::MCMatches::AddRecoMatch(const RecoHierarchy::Node *pRec
 
 unsigned int LArHierarchyHelper::MCMatches::GetSharedHits(const RecoHierarchy::Node *pReco) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
+    auto iter{m_recoNodeToIndexMap.find(pReco)};
+    if (iter == m_recoNodeToIndexMap.end())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-    int index = iter - m_recoNodes.begin();
 
-    return static_cast<int>(m_sharedHits[index]);
+    return static_cast<int>(m_sharedHits[iter->second]);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float LArHierarchyHelper::MCMatches::GetPurity(const RecoHierarchy::Node *pReco, const bool adcWeighted) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
+    if (m_recoNodeToIndexMap.find(pReco) == m_recoNodeToIndexMap.end())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
     const CaloHitList &recoHits{pReco->GetCaloHits()};
@@ -1041,8 +1042,7 @@ float LArHierarchyHelper::MCMatches::GetPurity(const RecoHierarchy::Node *pReco,
 float LArHierarchyHelper::MCMatches::GetPurity(const RecoHierarchy::Node *pReco, const HitType view, const bool adcWeighted) const
 {
     (void)view;
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
+    if (m_recoNodeToIndexMap.find(pReco) == m_recoNodeToIndexMap.end())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
     CaloHitList recoHits;
@@ -1064,8 +1064,7 @@ float LArHierarchyHelper::MCMatches::GetPurity(const RecoHierarchy::Node *pReco,
 
 float LArHierarchyHelper::MCMatches::GetCompleteness(const RecoHierarchy::Node *pReco, const bool adcWeighted) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
+    if (m_recoNodeToIndexMap.find(pReco) == m_recoNodeToIndexMap.end())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
     const CaloHitList &recoHits{pReco->GetCaloHits()};
@@ -1081,8 +1080,7 @@ float LArHierarchyHelper::MCMatches::GetCompleteness(const RecoHierarchy::Node *
 float LArHierarchyHelper::MCMatches::GetCompleteness(const RecoHierarchy::Node *pReco, const HitType view, const bool adcWeighted) const
 {
     (void)view;
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
+    if (m_recoNodeToIndexMap.find(pReco) == m_recoNodeToIndexMap.end())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
     CaloHitList recoHits;
@@ -1204,30 +1202,34 @@ void LArHierarchyHelper::MatchInfo::Match(const MCHierarchy &mcHierarchy, const
     std::sort(recoNodes.begin(), recoNodes.end(),
         [](const RecoHierarchy::Node *lhs, const RecoHierarchy::Node *rhs) { return lhs->GetCaloHits().size() > rhs->GetCaloHits().size(); });
 
+    // Index the reconstructable MC nodes by hit, so that each reco node need only visit its own hits
+    HitSharingIndex<const MCHierarchy::Node *, const CaloHit *> hitSharingIndex;
+    for (const MCHierarchy::Node *pMCNode : mcNodes)
+    {
+        if (pMCNode->IsReconstructable())
+            hitSharingIndex.AddKey(pMCNode, pMCNode->GetCaloHits());
+    }
+
     std::map<const MCHierarchy::Node *, MCMatches> mcToMatchMap;
+    HitSharingIndex<const MCHierarchy::Node *, const CaloHit *>::KeyIndexAndCountVector sharedHitCounts;
     for (const RecoHierarchy::Node *pRecoNode : recoNodes)
     {
-        const CaloHitList &recoHits{pRecoNode->GetCaloHits()};
+        // ATTN - Node hit lists are sorted, so shared hits are counted exactly as for a set intersection
+        hitSharingIndex.GetSharedHitCounts(pRecoNode->GetCaloHits(), sharedHitCounts);
+
+        // ATTN - Ties are resolved in favour of the earliest MC node, as for a scan over the sorted MC nodes
         const MCHierarchy::Node *pBestNode{nullptr};
-        size_t bestSharedHits{0};
-        for (const MCHierarchy::Node *pMCNode : mcNodes)
+        unsigned int bestSharedHits{0}, bestKeyIndex{0};
+        for (const auto &[keyIndex, sharedHits] : sharedHitCounts)
         {
-            if (!pMCNode->IsReconstructable())
-                continue;
-            const CaloHitList &mcHits{pMCNode->GetCaloHits()};
-            CaloHitVector intersection;
-            std::set_intersection(mcHits.begin(), mcHits.end(), recoHits.begin(), recoHits.end(), std::back_inserter(intersection));
-
-            if (!intersection.empty())
+            if ((sharedHits > bestSharedHits) || ((sharedHits == bestSharedHits) && (keyIndex < bestKeyIndex)))
             {
-                const size_t sharedHits{intersection.size()};
-                if (sharedHits > bestSharedHits)
-                {
-                    bestSharedHits = sharedHits;
-                    pBestNode = pMCNode;
-                }
+                bestSharedHits = sharedHits;
+                bestKeyIndex = keyIndex;
+                pBestNode = hitSharingIndex.GetKeys().at(keyIndex);
             }
         }
+
         if (pBestNode)
         {
             auto iter{mcToMatchMap.find(pBestNode)};
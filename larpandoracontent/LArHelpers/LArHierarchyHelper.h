@@ -15,6 +15,8 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -709,9 +711,12 @@ public:
          */
         float GetCompleteness(const pandora::CaloHitVector &intersection, const pandora::CaloHitList &mcHits, const bool adcWeighted) const;
 
-        const MCHierarchy::Node *m_pMCParticle; ///< MC node associated with any matches
-        RecoHierarchy::NodeVector m_recoNodes;  ///< Matched reco nodes
-        pandora::IntVector m_sharedHits;        ///< Number of shared hits for each match
+        typedef std::unordered_map<const RecoHierarchy::Node *, size_t> RecoNodeToIndexMap;
+
+        const MCHierarchy::Node *m_pMCParticle;  ///< MC node associated with any matches
+        RecoHierarchy::NodeVector m_recoNodes;   ///< Matched reco nodes
+        pandora::IntVector m_sharedHits;         ///< Number of shared hits for each match
+        RecoNodeToIndexMap m_recoNodeToIndexMap; ///< The index of the first match to each matched reco node
     };
 
     typedef std::vector<MCMatches> MCMatchesVector;
@@ -20,6 +20,8 @@
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include "larpandoracontent/LArObjects/LArHitSharingIndex.h"
+
 #include <algorithm>
 #include <cstdlib>
 
@@ -677,16 +679,29 @@ void LArMCParticleHelper::GetPfoMCParticleHitSharingMaps(const PfoContributionMa
         sortedPfos.push_back(mapEntry.first);
     std::sort(sortedPfos.begin(), sortedPfos.end(), LArPfoHelper::SortByNHits);
 
+    // Find the hits shared by each Pfo and MCParticle up front, visiting each hit once rather than once per Pfo and MCParticle pairing
+    std::vector<MCParticleVector> sortedMCParticlesVector;
+    std::vector<PfoToMCParticleSharedHitsMap> sharedHitsMatrices;
+    for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+    {
+        sortedMCParticlesVector.emplace_back();
+        MCParticleVector &sortedMCParticles(sortedMCParticlesVector.back());
+        for (const auto &mapEntry : mcParticleToHitsMap)
+            sortedMCParticles.push_back(mapEntry.first);
+        std::sort(sortedMCParticles.begin(), sortedMCParticles.end(), PointerLessThan<MCParticle>());
+
+        sharedHitsMatrices.emplace_back();
+        LArMCParticleHelper::GetPfoMCParticleHitSharingMatrix(pfoToReconstructable2DHitsMap, mcParticleToHitsMap, sharedHitsMatrices.back());
+    }
+
     for (const ParticleFlowObject *const pPfo : sortedPfos)
     {
-        for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+        for (unsigned int mapIndex = 0; mapIndex < selectedMCParticleToHitsMaps.size(); ++mapIndex)
         {
-            MCParticleVector sortedMCParticles;
-            for (const auto &mapEntry : mcParticleToHitsMap)
-                sortedMCParticles.push_back(mapEntry.first);
-            std::sort(sortedMCParticles.begin(), sortedMCParticles.end(), PointerLessThan<MCParticle>());
+            const PfoToMCParticleSharedHitsMap &sharedHitsMatrix(sharedHitsMatrices.at(mapIndex));
+            const PfoToMCParticleSharedHitsMap::const_iterator matrixIter(sharedHitsMatrix.find(pPfo));
 
-            for (const MCParticle *const pMCParticle : sortedMCParticles)
+            for (const MCParticle *const pMCParticle : sortedMCParticlesVector.at(mapIndex))
             {
                 // Add map entries for this Pfo & MCParticle if required
                 if (pfoToMCParticleHitSharingMap.find(pPfo) == pfoToMCParticleHitSharingMap.end())
@@ -709,11 +724,14 @@ void LArMCParticleHelper::GetPfoMCParticleHitSharingMaps(const PfoContributionMa
                     throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
 
                 // Add records to maps if there are any shared hits
-                const CaloHitList sharedHits(
-                    LArMCParticleHelper::GetSharedHits(pfoToReconstructable2DHitsMap.at(pPfo), mcParticleToHitsMap.at(pMCParticle)));
+                if (sharedHitsMatrix.end() == matrixIter)
+                    continue;
 
-                if (!sharedHits.empty())
+                const MCContributionMap::const_iterator sharedHitsIter(matrixIter->second.find(pMCParticle));
+
+                if (matrixIter->second.end() != sharedHitsIter)
                 {
+                    const CaloHitList &sharedHits(sharedHitsIter->second);
                     mcHitPairs.push_back(MCParticleCaloHitListPair(pMCParticle, sharedHits));
                     pfoHitPairs.push_back(PfoCaloHitListPair(pPfo, sharedHits));
 
@@ -733,6 +751,50 @@ void LArMCParticleHelper::GetPfoMCParticleHitSharingMaps(const PfoContributionMa
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArMCParticleHelper::GetPfoMCParticleHitSharingMatrix(const PfoContributionMap &pfoToReconstructable2DHitsMap,
+    const MCContributionMap &selectedMCParticleToHitsMap, PfoToMCParticleSharedHitCountMap &pfoToMCParticleSharedHitCountMap)
+{
+    HitSharingIndex<const MCParticle *, const CaloHit *> hitSharingIndex;
+
+    for (const auto &mapEntry : selectedMCParticleToHitsMap)
+        hitSharingIndex.AddKey(mapEntry.first, mapEntry.second);
+
+    HitSharingIndex<const MCParticle *, const CaloHit *>::KeyIndexAndCountVector sharedHitCounts;
+
+    for (const auto &mapEntry : pfoToReconstructable2DHitsMap)
+    {
+        hitSharingIndex.GetSharedHitCounts(mapEntry.second, sharedHitCounts);
+
+        if (sharedHitCounts.empty())
+            continue;
+
+        MCParticleToSharedHitCountMap &mcParticleToSharedHitCountMap(pfoToMCParticleSharedHitCountMap[mapEntry.first]);
+
+        for (const auto &[keyIndex, nSharedHits] : sharedHitCounts)
+            mcParticleToSharedHitCountMap[hitSharingIndex.GetKeys().at(keyIndex)] = nSharedHits;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMCParticleHelper::GetPfoMCParticleHitSharingMatrix(const PfoContributionMap &pfoToReconstructable2DHitsMap,
+    const MCContributionMap &selectedMCParticleToHitsMap, PfoToMCParticleSharedHitsMap &pfoToMCParticleSharedHitsMap)
+{
+    HitSharingIndex<const MCParticle *, const CaloHit *> hitSharingIndex;
+
+    for (const auto &mapEntry : selectedMCParticleToHitsMap)
+        hitSharingIndex.AddKey(mapEntry.first, mapEntry.second);
+
+    for (const auto &mapEntry : pfoToReconstructable2DHitsMap)
+    {
+        hitSharingIndex.ForEachSharedHit(mapEntry.second, [&](const unsigned int keyIndex, const CaloHit *const pCaloHit) {
+            pfoToMCParticleSharedHitsMap[mapEntry.first][hitSharingIndex.GetKeys().at(keyIndex)].push_back(pCaloHit);
+        });
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArMCParticleHelper::GetClusterToReconstructable2DHitsMap(const pandora::ClusterList &clusterList,
     const MCContributionMap &selectedMCToHitsMap, ClusterContributionMap &clusterToReconstructable2DHitsMap)
 {
@@ -49,6 +49,10 @@ public:
     typedef std::map<const pandora::ParticleFlowObject *, MCParticleToSharedHitsVector> PfoToMCParticleHitSharingMap;
     typedef std::map<const pandora::MCParticle *, PfoToSharedHitsVector> MCParticleToPfoHitSharingMap;
 
+    typedef std::unordered_map<const pandora::MCParticle *, unsigned int> MCParticleToSharedHitCountMap;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, MCParticleToSharedHitCountMap> PfoToMCParticleSharedHitCountMap;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, MCContributionMap> PfoToMCParticleSharedHitsMap;
+
     /**
      *  @brief   PrimaryParameters class
      */
@@ -405,6 +409,30 @@ public:
         const MCContributionMapVector &selectedMCParticleToHitsMaps, PfoToMCParticleHitSharingMap &pfoToMCParticleHitSharingMap,
         MCParticleToPfoHitSharingMap &mcParticleToPfoHitSharingMap);
 
+    /**
+     *  @brief  Get the sparse matrix of the number of reconstructable 2D hits shared between each Pfo and selected reconstructable MCParticle,
+     *          visiting each Pfo hit once and without listing the shared hits. Only Pfo and MCParticle pairs with shared hits are recorded.
+     *          As the hits of a Pfo are distinct, the counts are the sizes of the lists given by GetSharedHits.
+     *
+     *  @param  pfoToReconstructable2DHitsMap the input mapping from Pfos to reconstructable 2D hits
+     *  @param  selectedMCParticleToHitsMap the input mapping from selected reconstructable MCParticles to hits
+     *  @param  pfoToMCParticleSharedHitCountMap the output mapping from Pfos to selected reconstructable MCParticles and the number of hits shared
+     */
+    static void GetPfoMCParticleHitSharingMatrix(const PfoContributionMap &pfoToReconstructable2DHitsMap,
+        const MCContributionMap &selectedMCParticleToHitsMap, PfoToMCParticleSharedHitCountMap &pfoToMCParticleSharedHitCountMap);
+
+    /**
+     *  @brief  Get the sparse matrix of the reconstructable 2D hits shared between each Pfo and selected reconstructable MCParticle,
+     *          visiting each Pfo hit once. Only Pfo and MCParticle pairs with shared hits are recorded, and the shared hits are listed in
+     *          Pfo hit order, as for GetSharedHits.
+     *
+     *  @param  pfoToReconstructable2DHitsMap the input mapping from Pfos to reconstructable 2D hits
+     *  @param  selectedMCParticleToHitsMap the input mapping from selected reconstructable MCParticles to hits
+     *  @param  pfoToMCParticleSharedHitsMap the output mapping from Pfos to selected reconstructable MCParticles and the hits shared
+     */
+    static void GetPfoMCParticleHitSharingMatrix(const PfoContributionMap &pfoToReconstructable2DHitsMap,
+        const MCContributionMap &selectedMCParticleToHitsMap, PfoToMCParticleSharedHitsMap &pfoToMCParticleSharedHitsMap);
+
     /**
      *  @brief  Select a subset of calo hits representing those that represent "reconstructable" regions of the event
      *
@@ -0,0 +1,156 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.cc
+ *
+ *  @brief  Implementation of the sliding fit cache helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/PandoraInternal.h"
+
+#include "Objects/Cluster.h"
+
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArSlidingFitCacheHelper::CacheMap LArSlidingFitCacheHelper::m_cacheMap;
+std::mutex LArSlidingFitCacheHelper::m_mutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const TwoDSlidingFitResult &LArSlidingFitCacheHelper::GetTwoDSlidingFitResult(const Pandora &pandora, const Cluster *const pCluster,
+    const unsigned int layerFitHalfWindow, const float layerPitch, TwoDSlidingFitResultPtr &pUncachedFitResult)
+{
+    Cache *const pCache(LArSlidingFitCacheHelper::GetCache(pandora));
+
+    if (!pCache)
+    {
+        pUncachedFitResult.reset(new TwoDSlidingFitResult(pCluster, layerFitHalfWindow, layerPitch));
+        return *pUncachedFitResult;
+    }
+
+    const FitKey fitKey(pCluster, layerFitHalfWindow, layerPitch);
+    TwoDFitMap::iterator iter(pCache->m_twoDFitMap.find(fitKey));
+
+    if (pCache->m_twoDFitMap.end() != iter)
+    {
+        if (iter->second.m_clusterState.IsUnchanged(pCluster))
+        {
+            ++pCache->m_statistics.m_nHits;
+            return iter->second.m_fitResult;
+        }
+
+        ++pCache->m_statistics.m_nInvalidations;
+        pCache->m_twoDFitMap.erase(iter);
+    }
+
+    ++pCache->m_statistics.m_nMisses;
+    const std::pair<TwoDFitMap::iterator, bool> insertion(pCache->m_twoDFitMap.emplace(std::piecewise_construct, std::forward_as_tuple(fitKey),
+        std::forward_as_tuple(ClusterState(pCluster), pCluster, layerFitHalfWindow, layerPitch)));
+
+    return insertion.first->second.m_fitResult;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::EnableCache(const Pandora &pandora)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cacheMap[&pandora].reset(new Cache);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::DisableCache(const Pandora &pandora)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cacheMap.erase(&pandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::ResetCache(const Pandora &pandora)
+{
+    Cache *const pCache(LArSlidingFitCacheHelper::GetCache(pandora));
+
+    if (!pCache)
+        return;
+
+    pCache->m_twoDFitMap.clear();
+    pCache->m_statistics = Statistics();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArSlidingFitCacheHelper::Statistics LArSlidingFitCacheHelper::GetStatistics(const Pandora &pandora)
+{
+    const Cache *const pCache(LArSlidingFitCacheHelper::GetCache(pandora));
+    return (pCache ? pCache->m_statistics : Statistics());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArSlidingFitCacheHelper::Cache *LArSlidingFitCacheHelper::GetCache(const Pandora &pandora)
+{
+    // ATTN Only the map itself is shared between threads; each cache is only ever used by the thread running its pandora instance
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CacheMap::const_iterator iter(m_cacheMap.find(&pandora));
+
+    return ((m_cacheMap.end() != iter) ? iter->second.get() : nullptr);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArSlidingFitCacheHelper::Statistics::Statistics() :
+    m_nHits(0),
+    m_nMisses(0),
+    m_nInvalidations(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArSlidingFitCacheHelper::ClusterState::ClusterState(const Cluster *const pCluster)
+{
+    m_caloHitVector.reserve(pCluster->GetNCaloHits());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+        m_caloHitVector.insert(m_caloHitVector.end(), layerEntry.second->begin(), layerEntry.second->end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArSlidingFitCacheHelper::ClusterState::IsUnchanged(const Cluster *const pCluster) const
+{
+    // ATTN Compare in place, so that a valid entry costs no allocations
+    CaloHitVector::const_iterator hitIter(m_caloHitVector.begin());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            if ((m_caloHitVector.end() == hitIter) || (pCaloHit != *hitIter))
+                return false;
+
+            ++hitIter;
+        }
+    }
+
+    return (m_caloHitVector.end() == hitIter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArSlidingFitCacheHelper::FitEntry::FitEntry(
+    const ClusterState &clusterState, const Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch) :
+    m_clusterState(clusterState),
+    m_fitResult(pCluster, layerFitHalfWindow, layerPitch)
+{
+}
+
+} // namespace lar_content
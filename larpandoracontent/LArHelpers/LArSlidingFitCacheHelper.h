@@ -0,0 +1,175 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h
+ *
+ *  @brief  Header file for the sliding fit cache helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SLIDING_FIT_CACHE_HELPER_H
+#define LAR_SLIDING_FIT_CACHE_HELPER_H 1
+
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArSlidingFitCacheHelper class. Provides an event-scoped cache of the two dimensional sliding fits to clusters, shared by all
+ *          algorithms in a pandora instance and keyed by (cluster, sliding fit window, layer pitch). Pandora offers no notification of
+ *          cluster modification, so each entry records the calo hits from which its fit was calculated, in the order of the ordered calo
+ *          hit list of the cluster. An entry is invalidated, and its fit recalculated, if the calo hits of the cluster now differ in any way,
+ *          whether the cluster has been modified or merged, or deleted and its address reused. The check is linear in the number of hits,
+ *          but makes no allocations and is much cheaper than the fit. The cache is only active in pandora instances in which it has been
+ *          enabled, otherwise fits are simply calculated on demand.
+ */
+class LArSlidingFitCacheHelper
+{
+public:
+    /**
+     *  @brief  Statistics class, the cache usage counters for the current event
+     */
+    class Statistics
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Statistics();
+
+        unsigned int m_nHits;          ///< The number of fits returned from the cache
+        unsigned int m_nMisses;        ///< The number of fits calculated and added to the cache
+        unsigned int m_nInvalidations; ///< The number of cached fits discarded because the cluster had been modified
+    };
+
+    typedef std::unique_ptr<TwoDSlidingFitResult> TwoDSlidingFitResultPtr;
+
+    /**
+     *  @brief  Get the sliding fit to a two dimensional cluster, from the cache if available. A cached fit remains valid until the cache
+     *          is reset, or until the fit to the same cluster is next requested after the cluster has been modified.
+     *
+     *  @param  pandora the pandora instance
+     *  @param  pCluster address of the cluster
+     *  @param  layerFitHalfWindow the layer fit half window
+     *  @param  layerPitch the layer pitch, units cm
+     *  @param  pUncachedFitResult to own the fit result if the cache is not enabled for the pandora instance
+     *
+     *  @return the sliding fit result
+     */
+    static const TwoDSlidingFitResult &GetTwoDSlidingFitResult(const pandora::Pandora &pandora, const pandora::Cluster *const pCluster,
+        const unsigned int layerFitHalfWindow, const float layerPitch, TwoDSlidingFitResultPtr &pUncachedFitResult);
+
+    /**
+     *  @brief  Enable the cache for a pandora instance, clearing any existing contents
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void EnableCache(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Disable the cache for a pandora instance, releasing its contents
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void DisableCache(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Clear the cache contents and usage counters for a pandora instance, typically at the end of each event
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void ResetCache(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Get the cache usage counters for a pandora instance, accumulated since the cache was last reset
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the statistics, all zero if the cache is not enabled
+     */
+    static Statistics GetStatistics(const pandora::Pandora &pandora);
+
+private:
+    typedef std::tuple<const pandora::Cluster *, unsigned int, float> FitKey;
+
+    /**
+     *  @brief  ClusterState class, the calo hits of a cluster, from which any fit to the cluster is calculated
+     */
+    class ClusterState
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         */
+        explicit ClusterState(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Whether a cluster holds exactly the recorded calo hits, in the same order
+         *
+         *  @param  pCluster address of the cluster
+         *
+         *  @return boolean
+         */
+        bool IsUnchanged(const pandora::Cluster *const pCluster) const;
+
+        pandora::CaloHitVector m_caloHitVector; ///< The calo hits, in the order of the ordered calo hit list of the cluster
+    };
+
+    /**
+     *  @brief  FitEntry class, a cached fit and the state of the cluster from which it was calculated
+     */
+    class FitEntry
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  clusterState the cluster state
+         *  @param  pCluster address of the cluster
+         *  @param  layerFitHalfWindow the layer fit half window
+         *  @param  layerPitch the layer pitch, units cm
+         */
+        FitEntry(const ClusterState &clusterState, const pandora::Cluster *const pCluster, const unsigned int layerFitHalfWindow,
+            const float layerPitch);
+
+        ClusterState m_clusterState;      ///< The cluster state
+        TwoDSlidingFitResult m_fitResult; ///< The fit result
+    };
+
+    typedef std::map<FitKey, FitEntry> TwoDFitMap;
+
+    /**
+     *  @brief  Cache class, the cached fits for a single pandora instance
+     */
+    class Cache
+    {
+    public:
+        TwoDFitMap m_twoDFitMap; ///< The cached two dimensional sliding fits
+        Statistics m_statistics; ///< The cache usage counters
+    };
+
+    typedef std::unordered_map<const pandora::Pandora *, std::unique_ptr<Cache>> CacheMap;
+
+    /**
+     *  @brief  Get the cache for a pandora instance
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return address of the cache, or nullptr if the cache is not enabled
+     */
+    static Cache *GetCache(const pandora::Pandora &pandora);
+
+    static CacheMap m_cacheMap; ///< The caches, one per pandora instance in which the cache is enabled
+    static std::mutex m_mutex;  ///< The mutex guarding the map of caches, as pandora instances may run in separate threads
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SLIDING_FIT_CACHE_HELPER_H
@@ -0,0 +1,163 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArThreadingHelper.h
+ *
+ *  @brief  Header file for the threading helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_THREADING_HELPER_H
+#define LAR_THREADING_HELPER_H 1
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArThreadingHelper class
+ */
+class LArThreadingHelper
+{
+public:
+    /**
+     *  @brief  Invoke a task for each index in the range [0, nTasks), distributing the indices dynamically over a number of threads.
+     *          The calling thread participates in the work. If any task throws, no further tasks are started and the first exception
+     *          is rethrown in the calling thread once all threads have been joined.
+     *
+     *  @param  nTasks the number of tasks
+     *  @param  nThreads the maximum number of threads to use; tasks are run serially, in index order, if this is zero or one
+     *  @param  task the callable, invoked with the task index
+     */
+    template <typename TASK>
+    static void ParallelFor(const unsigned int nTasks, const unsigned int nThreads, const TASK &task);
+
+    /**
+     *  @brief  Calculate a result for each index in the range [0, nTasks), possibly concurrently, then store the results serially, in
+     *          index order, in the calling thread. The calculations may only read state that no calculation or other thread modifies;
+     *          anything with side effects, including screen output, belongs in the store step. If a calculation throws, the results for
+     *          all preceding indices are stored and the exception is then rethrown, exactly as for a serial loop of calculate and store.
+     *
+     *  @param  nTasks the number of tasks
+     *  @param  nThreads the maximum number of threads to use for the calculations
+     *  @param  calculate the callable, invoked with the task index and a reference to a default-constructed result
+     *  @param  store the callable, invoked with the task index and the calculated result
+     */
+    template <typename RESULT, typename CALCULATE, typename STORE>
+    static void ParallelCalculateThenStore(const unsigned int nTasks, const unsigned int nThreads, const CALCULATE &calculate, const STORE &store);
+
+    /**
+     *  @brief  Get the number of threads to use for a requested thread count, where zero requests the hardware concurrency
+     *
+     *  @param  nRequestedThreads the requested number of threads
+     *
+     *  @return the number of threads to use, always at least one
+     */
+    static unsigned int GetNThreads(const unsigned int nRequestedThreads);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TASK>
+inline void LArThreadingHelper::ParallelFor(const unsigned int nTasks, const unsigned int nThreads, const TASK &task)
+{
+    const unsigned int nWorkers(std::min(nTasks, nThreads));
+
+    if (nWorkers < 2)
+    {
+        for (unsigned int iTask = 0; iTask < nTasks; ++iTask)
+            task(iTask);
+
+        return;
+    }
+
+    std::atomic<unsigned int> nextTask(0);
+    std::exception_ptr pException(nullptr);
+    std::mutex exceptionMutex;
+
+    auto worker = [&]() {
+        while (true)
+        {
+            const unsigned int iTask(nextTask++);
+
+            if (iTask >= nTasks)
+                return;
+
+            try
+            {
+                task(iTask);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+
+                if (!pException)
+                    pException = std::current_exception();
+
+                nextTask = nTasks;
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nWorkers - 1);
+
+    for (unsigned int iThread = 1; iThread < nWorkers; ++iThread)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    if (pException)
+        std::rethrow_exception(pException);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename RESULT, typename CALCULATE, typename STORE>
+inline void LArThreadingHelper::ParallelCalculateThenStore(
+    const unsigned int nTasks, const unsigned int nThreads, const CALCULATE &calculate, const STORE &store)
+{
+    std::vector<RESULT> results(nTasks);
+    std::vector<std::exception_ptr> exceptions(nTasks, nullptr);
+
+    LArThreadingHelper::ParallelFor(nTasks, nThreads, [&](const unsigned int iTask) {
+        try
+        {
+            calculate(iTask, results.at(iTask));
+        }
+        catch (...)
+        {
+            exceptions.at(iTask) = std::current_exception();
+        }
+    });
+
+    for (unsigned int iTask = 0; iTask < nTasks; ++iTask)
+    {
+        if (exceptions.at(iTask))
+            std::rethrow_exception(exceptions.at(iTask));
+
+        store(iTask, results.at(iTask));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int LArThreadingHelper::GetNThreads(const unsigned int nRequestedThreads)
+{
+    if (nRequestedThreads > 0)
+        return nRequestedThreads;
+
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_THREADING_HELPER_H
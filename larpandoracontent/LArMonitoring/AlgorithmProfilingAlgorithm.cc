@@ -0,0 +1,263 @@
+/**
+ *  @file   larpandoracontent/LArMonitoring/AlgorithmProfilingAlgorithm.cc
+ *
+ *  @brief  Implementation of the algorithm profiling algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArMonitoring/AlgorithmProfilingAlgorithm.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <new>
+
+using namespace pandora;
+
+namespace
+{
+
+/**
+ *  @brief  AllocationCount class, the heap allocations made by the current thread
+ */
+class AllocationCount
+{
+public:
+    uint64_t m_nAllocations;   ///< The number of heap allocations
+    uint64_t m_allocatedBytes; ///< The number of heap bytes allocated
+};
+
+// ATTN Constant initialised, so safe to use from operator new at any point in the life of a thread
+thread_local AllocationCount threadAllocationCount{0, 0};
+
+} // namespace
+
+#ifdef LAR_COUNT_ALLOCATIONS
+
+// ATTN The other replaceable allocation functions either forward to these or, like the deallocation functions, need no replacement
+void *operator new(std::size_t size)
+{
+    ++threadAllocationCount.m_nAllocations;
+    threadAllocationCount.m_allocatedBytes += size;
+
+    if (void *const pMemory = std::malloc(size ? size : 1))
+        return pMemory;
+
+    throw std::bad_alloc();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    ++threadAllocationCount.m_nAllocations;
+    threadAllocationCount.m_allocatedBytes += size;
+
+    const std::size_t align(static_cast<std::size_t>(alignment));
+    const std::size_t alignedSize(((size ? size : 1) + align - 1) / align * align);
+
+    if (void *const pMemory = std::aligned_alloc(align, alignedSize))
+        return pMemory;
+
+    throw std::bad_alloc();
+}
+
+#endif // #ifdef LAR_COUNT_ALLOCATIONS
+
+namespace lar_content
+{
+
+std::mutex AlgorithmProfilingAlgorithm::m_outputFileMutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AlgorithmProfilingAlgorithm::AlgorithmProfilingAlgorithm() :
+    m_nEvents(0),
+    m_printSummary(true)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode AlgorithmProfilingAlgorithm::Run()
+{
+    for (Profile &profile : m_eventProfiles)
+    {
+        const AllocationCount allocationsBefore(threadAllocationCount);
+        const auto startTime(std::chrono::steady_clock::now());
+
+        const StatusCode statusCode(PandoraContentApi::RunDaughterAlgorithm(*this, profile.m_algorithmName));
+
+        const double time(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count());
+        const AllocationCount allocationsAfter(threadAllocationCount);
+
+        ++profile.m_nCalls;
+        profile.m_totalTime += time;
+        profile.m_maxTime = std::max(profile.m_maxTime, time);
+        profile.m_nAllocations += allocationsAfter.m_nAllocations - allocationsBefore.m_nAllocations;
+        profile.m_allocatedBytes += allocationsAfter.m_allocatedBytes - allocationsBefore.m_allocatedBytes;
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, statusCode);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode AlgorithmProfilingAlgorithm::Reset()
+{
+    const bool hasRun(std::any_of(m_eventProfiles.begin(), m_eventProfiles.end(), [](const Profile &profile) { return profile.m_nCalls > 0; }));
+
+    if (!hasRun)
+        return STATUS_CODE_SUCCESS;
+
+    const StatusCode statusCode(this->WriteEvent());
+
+    ++m_nEvents;
+
+    for (unsigned int iProfile = 0; iProfile < m_eventProfiles.size(); ++iProfile)
+    {
+        m_totalProfiles.at(iProfile).Add(m_eventProfiles.at(iProfile));
+        m_eventProfiles.at(iProfile).ClearMeasurements();
+    }
+
+    if (m_printSummary)
+        this->PrintSummary();
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode AlgorithmProfilingAlgorithm::WriteEvent() const
+{
+    if (m_outputFileName.empty())
+        return STATUS_CODE_SUCCESS;
+
+    // ATTN Every instance appends to the same file, so the header check and the append must not interleave with those of other instances
+    std::lock_guard<std::mutex> lock(m_outputFileMutex);
+
+    const bool writeHeader(!std::ifstream(m_outputFileName).good());
+    std::ofstream outputFile(m_outputFileName, std::ios::app);
+
+    if (!outputFile.good())
+    {
+        std::cout << "AlgorithmProfilingAlgorithm: Unable to open output file " << m_outputFileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    if (writeHeader)
+        outputFile << "PandoraInstance,Event,AlgorithmName,AlgorithmType,NCalls,TimeMs,MaxTimeMs,NAllocations,AllocatedBytes" << std::endl;
+
+    for (const Profile &profile : m_eventProfiles)
+    {
+        outputFile << m_pandoraName << "," << m_nEvents << "," << profile.m_algorithmName << "," << profile.m_algorithmType << ","
+                   << profile.m_nCalls << "," << profile.m_totalTime << "," << profile.m_maxTime << "," << profile.m_nAllocations << ","
+                   << profile.m_allocatedBytes << std::endl;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AlgorithmProfilingAlgorithm::PrintSummary() const
+{
+    const std::ios_base::fmtflags flags(std::cout.flags());
+    const std::streamsize precision(std::cout.precision());
+
+    double totalTime(0.);
+    for (const Profile &profile : m_totalProfiles)
+        totalTime += profile.m_totalTime;
+
+    std::cout << "AlgorithmProfilingAlgorithm: Summary for pandora instance '" << m_pandoraName << "', " << m_nEvents << " event(s)" << std::endl;
+
+    for (const Profile &profile : m_totalProfiles)
+    {
+        const double timeFraction(totalTime > 0. ? profile.m_totalTime / totalTime : 0.);
+
+        std::cout << "  " << std::left << std::setw(50) << profile.m_algorithmName << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(12) << profile.m_totalTime / m_nEvents << " ms/event" << std::setprecision(1) << std::setw(8) << 100. * timeFraction
+                  << " %" << std::setw(12) << profile.m_nAllocations / m_nEvents << " allocs/event" << std::setw(14)
+                  << profile.m_allocatedBytes / m_nEvents << " B/event" << std::endl;
+    }
+
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode AlgorithmProfilingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    StringVector algorithmNames;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmList(*this, xmlHandle, "ProfiledAlgorithms", algorithmNames));
+
+    // ATTN The algorithm names are returned in the order in which the algorithm elements appear
+    const TiXmlElement *pAlgorithmXmlElement(xmlHandle.FirstChild("ProfiledAlgorithms").FirstChildElement("algorithm").ToElement());
+
+    for (const std::string &algorithmName : algorithmNames)
+    {
+        Profile profile;
+        profile.m_algorithmName = algorithmName;
+
+        if (pAlgorithmXmlElement)
+        {
+            const char *const pType(pAlgorithmXmlElement->Attribute("type"));
+            profile.m_algorithmType = pType ? pType : "";
+            pAlgorithmXmlElement = pAlgorithmXmlElement->NextSiblingElement("algorithm");
+        }
+
+        m_eventProfiles.push_back(profile);
+    }
+
+    m_totalProfiles = m_eventProfiles;
+    m_pandoraName = this->GetPandora().GetName();
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "OutputFileName", m_outputFileName));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PrintSummary", m_printSummary));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AlgorithmProfilingAlgorithm::Profile::Profile() :
+    m_nCalls(0),
+    m_totalTime(0.),
+    m_maxTime(0.),
+    m_nAllocations(0),
+    m_allocatedBytes(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AlgorithmProfilingAlgorithm::Profile::Add(const Profile &other)
+{
+    m_nCalls += other.m_nCalls;
+    m_totalTime += other.m_totalTime;
+    m_maxTime = std::max(m_maxTime, other.m_maxTime);
+    m_nAllocations += other.m_nAllocations;
+    m_allocatedBytes += other.m_allocatedBytes;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AlgorithmProfilingAlgorithm::Profile::ClearMeasurements()
+{
+    m_nCalls = 0;
+    m_totalTime = 0.;
+    m_maxTime = 0.;
+    m_nAllocations = 0;
+    m_allocatedBytes = 0;
+}
+
+} // namespace lar_content
@@ -0,0 +1,100 @@
+/**
+ *  @file   larpandoracontent/LArMonitoring/AlgorithmProfilingAlgorithm.h
+ *
+ *  @brief  Header file for the algorithm profiling algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_ALGORITHM_PROFILING_ALGORITHM_H
+#define LAR_ALGORITHM_PROFILING_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+#include <cstdint>
+#include <mutex>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  AlgorithmProfilingAlgorithm class. Runs a list of daughter algorithms, recording the wall-clock time, call count and heap
+ *          allocations of each. Any algorithm tools are attributed to the daughter algorithm that runs them. The measurements are written
+ *          when the pandora instance is reset after each event, so wrapping the algorithm chains in the worker settings files profiles each
+ *          worker separately.
+ *
+ *          Heap allocations are only counted if the library is built with LAR_COUNT_ALLOCATIONS defined, which replaces the global
+ *          operator new with a counting version. The counts are per thread, so allocations made by any threads that a daughter algorithm
+ *          starts itself are not included.
+ */
+class AlgorithmProfilingAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    AlgorithmProfilingAlgorithm();
+
+private:
+    /**
+     *  @brief  Profile class, the accumulated measurements for a single daughter algorithm
+     */
+    class Profile
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Profile();
+
+        /**
+         *  @brief  Add the measurements from another profile of the same daughter algorithm
+         *
+         *  @param  other the other profile
+         */
+        void Add(const Profile &other);
+
+        /**
+         *  @brief  Clear the measurements, keeping the daughter algorithm details
+         */
+        void ClearMeasurements();
+
+        std::string m_algorithmName; ///< The daughter algorithm name
+        std::string m_algorithmType; ///< The daughter algorithm type
+        unsigned int m_nCalls;       ///< The number of calls
+        double m_totalTime;          ///< The total wall-clock time, in ms
+        double m_maxTime;            ///< The largest wall-clock time for a single call, in ms
+        uint64_t m_nAllocations;     ///< The number of heap allocations
+        uint64_t m_allocatedBytes;   ///< The number of heap bytes allocated
+    };
+
+    typedef std::vector<Profile> ProfileVector;
+
+    pandora::StatusCode Run();
+    pandora::StatusCode Reset();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    /**
+     *  @brief  Append the measurements for the current event to the output csv file
+     *
+     *  @return status code
+     */
+    pandora::StatusCode WriteEvent() const;
+
+    /**
+     *  @brief  Print the summary of the measurements accumulated over all events so far
+     */
+    void PrintSummary() const;
+
+    ProfileVector m_eventProfiles; ///< The profiles for the current event, one per daughter algorithm, in order of execution
+    ProfileVector m_totalProfiles; ///< The profiles accumulated over all completed events
+    unsigned int m_nEvents;        ///< The number of completed events
+    std::string m_pandoraName;     ///< The name of the pandora instance running this algorithm
+    std::string m_outputFileName;  ///< The name of the csv file to which the measurements are appended (none if empty)
+    bool m_printSummary;           ///< Whether to print the summary to the screen after each event
+
+    static std::mutex m_outputFileMutex; ///< The mutex guarding the output files, as pandora instances may be reset in separate threads
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_ALGORITHM_PROFILING_ALGORITHM_H
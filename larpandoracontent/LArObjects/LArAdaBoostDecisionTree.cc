@@ -139,6 +139,41 @@ double AdaBoostDecisionTree::CalculateProbability(const LArMvaHelper::MvaFeature
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void AdaBoostDecisionTree::CalculateClassificationScores(const MvaFeatureVectorList &featuresList, ScoreVector &scores) const
+{
+    if (!m_pStrongClassifier)
+    {
+        std::cout << "AdaBoostDecisionTree: Attempting to use an uninitialized bdt" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+
+    try
+    {
+        m_pStrongClassifier->Predict(featuresList, scores);
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        AdaBoostDecisionTree::ReportException(statusCodeException);
+        throw statusCodeException;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::CalculateProbabilities(const MvaFeatureVectorList &featuresList, ScoreVector &probabilities) const
+{
+    ScoreVector scores;
+    this->CalculateClassificationScores(featuresList, scores);
+
+    // ATTN: Apply the same linear mapping as for a single set of features
+    for (double &score : scores)
+        score = (score + 1.) * 0.5;
+
+    probabilities.swap(scores);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 double AdaBoostDecisionTree::CalculateScore(const LArMvaHelper::MvaFeatureVector &features) const
 {
     if (!m_pStrongClassifier)
@@ -154,28 +189,34 @@ double AdaBoostDecisionTree::CalculateScore(const LArMvaHelper::MvaFeatureVector
     }
     catch (StatusCodeException &statusCodeException)
     {
-        if (STATUS_CODE_NOT_FOUND == statusCodeException.GetStatusCode())
-        {
-            std::cout << "AdaBoostDecisionTree: Caught exception thrown when trying to cut on an unknown variable." << std::endl;
-        }
-        else if (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode())
-        {
-            std::cout << "AdaBoostDecisionTree: Caught exception thrown when classifier weights sum to zero indicating defunct classifier."
-                      << std::endl;
-        }
-        else if (STATUS_CODE_OUT_OF_RANGE == statusCodeException.GetStatusCode())
-        {
-            std::cout << "AdaBoostDecisionTree: Caught exception thrown when heirarchy in decision tree is incomplete." << std::endl;
-        }
-        else
-        {
-            std::cout << "AdaBoostDecisionTree: Unexpected exception thrown." << std::endl;
-        }
-
+        AdaBoostDecisionTree::ReportException(statusCodeException);
         throw statusCodeException;
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::ReportException(const StatusCodeException &statusCodeException)
+{
+    if (STATUS_CODE_NOT_FOUND == statusCodeException.GetStatusCode())
+    {
+        std::cout << "AdaBoostDecisionTree: Caught exception thrown when trying to cut on an unknown variable." << std::endl;
+    }
+    else if (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode())
+    {
+        std::cout << "AdaBoostDecisionTree: Caught exception thrown when classifier weights sum to zero indicating defunct classifier."
+                  << std::endl;
+    }
+    else if (STATUS_CODE_OUT_OF_RANGE == statusCodeException.GetStatusCode())
+    {
+        std::cout << "AdaBoostDecisionTree: Caught exception thrown when heirarchy in decision tree is incomplete." << std::endl;
+    }
+    else
+    {
+        std::cout << "AdaBoostDecisionTree: Unexpected exception thrown." << std::endl;
+    }
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -322,40 +363,59 @@ AdaBoostDecisionTree::WeakClassifier::~WeakClassifier()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool AdaBoostDecisionTree::WeakClassifier::Predict(const LArMvaHelper::MvaFeatureVector &features) const
+int AdaBoostDecisionTree::WeakClassifier::CompileNodes(FlatNodeVector &flatNodeVector) const
 {
-    return this->EvaluateNode(0, features);
-}
+    IdToNodeMap::const_iterator rootIter(m_idToNodeMap.find(0));
 
-//------------------------------------------------------------------------------------------------------------------------------------------
+    if (m_idToNodeMap.end() == rootIter)
+        return -1;
 
-bool AdaBoostDecisionTree::WeakClassifier::EvaluateNode(const int nodeId, const LArMvaHelper::MvaFeatureVector &features) const
-{
-    const Node *pActiveNode(nullptr);
+    // ATTN Nodes are appended in breadth-first order, so the position of each node is the root position plus its position in the queue
+    const int rootIndex(static_cast<int>(flatNodeVector.size()));
+    std::map<int, int> idToIndexMap;
+    std::vector<const Node *> nodeQueue;
 
-    if (m_idToNodeMap.find(nodeId) != m_idToNodeMap.end())
-    {
-        pActiveNode = m_idToNodeMap.at(nodeId);
-    }
-    else
+    idToIndexMap.insert(std::map<int, int>::value_type(0, rootIndex));
+    nodeQueue.push_back(rootIter->second);
+    flatNodeVector.emplace_back(*rootIter->second);
+
+    for (size_t queueIndex = 0; queueIndex < nodeQueue.size(); ++queueIndex)
     {
-        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
-    }
+        const Node *const pNode(nodeQueue.at(queueIndex));
 
-    if (pActiveNode->IsLeaf())
-        return pActiveNode->GetOutcome();
+        if (pNode->IsLeaf())
+            continue;
 
-    if (static_cast<int>(features.size()) <= pActiveNode->GetVariableId())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+        int childIndices[2] = {-1, -1};
+        const int childNodeIds[2] = {pNode->GetLeftChildNodeId(), pNode->GetRightChildNodeId()};
 
-    if (features.at(pActiveNode->GetVariableId()).Get() <= pActiveNode->GetThreshold())
-    {
-        return this->EvaluateNode(pActiveNode->GetLeftChildNodeId(), features);
-    }
-    else
-    {
-        return this->EvaluateNode(pActiveNode->GetRightChildNodeId(), features);
+        for (unsigned int child = 0; child < 2; ++child)
+        {
+            IdToNodeMap::const_iterator childIter(m_idToNodeMap.find(childNodeIds[child]));
+
+            if (m_idToNodeMap.end() == childIter)
+                continue;
+
+            std::map<int, int>::const_iterator indexIter(idToIndexMap.find(childNodeIds[child]));
+
+            if (idToIndexMap.end() != indexIter)
+            {
+                childIndices[child] = indexIter->second;
+                continue;
+            }
+
+            childIndices[child] = static_cast<int>(flatNodeVector.size());
+            idToIndexMap.insert(std::map<int, int>::value_type(childNodeIds[child], childIndices[child]));
+            nodeQueue.push_back(childIter->second);
+            flatNodeVector.emplace_back(*childIter->second);
+        }
+
+        FlatNode &flatNode(flatNodeVector.at(rootIndex + queueIndex));
+        flatNode.m_leftIndex = childIndices[0];
+        flatNode.m_rightIndex = childIndices[1];
     }
+
+    return rootIndex;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -372,6 +432,8 @@ AdaBoostDecisionTree::StrongClassifier::StrongClassifier(const TiXmlHandle *cons
 
         pCurrentXmlElement = pCurrentXmlElement->NextSiblingElement();
     }
+
+    this->CompileWeakClassifiers();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -380,6 +442,8 @@ AdaBoostDecisionTree::StrongClassifier::StrongClassifier(const StrongClassifier
 {
     for (const WeakClassifier *const pWeakClassifier : rhs.m_weakClassifiers)
         m_weakClassifiers.emplace_back(new WeakClassifier(*pWeakClassifier));
+
+    this->CompileWeakClassifiers();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -390,6 +454,8 @@ AdaBoostDecisionTree::StrongClassifier &AdaBoostDecisionTree::StrongClassifier::
     {
         for (const WeakClassifier *const pWeakClassifier : rhs.m_weakClassifiers)
             m_weakClassifiers.emplace_back(new WeakClassifier(*pWeakClassifier));
+
+        this->CompileWeakClassifiers();
     }
 
     return *this;
@@ -409,17 +475,18 @@ double AdaBoostDecisionTree::StrongClassifier::Predict(const LArMvaHelper::MvaFe
 {
     double score(0.), weights(0.);
 
-    for (const WeakClassifier *const pWeakClassifier : m_weakClassifiers)
+    for (size_t treeIndex = 0, nTrees = m_rootIndices.size(); treeIndex < nTrees; ++treeIndex)
     {
-        weights += pWeakClassifier->GetWeight();
+        const double weight(m_weights[treeIndex]);
+        weights += weight;
 
-        if (pWeakClassifier->Predict(features))
+        if (this->EvaluateTree(m_rootIndices[treeIndex], features))
         {
-            score += pWeakClassifier->GetWeight();
+            score += weight;
         }
         else
         {
-            score -= pWeakClassifier->GetWeight();
+            score -= weight;
         }
     }
 
@@ -437,6 +504,41 @@ double AdaBoostDecisionTree::StrongClassifier::Predict(const LArMvaHelper::MvaFe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void AdaBoostDecisionTree::StrongClassifier::Predict(const MvaFeatureVectorList &featuresList, ScoreVector &scores) const
+{
+    // ATTN Scores are accumulated over the trees in the same order as for a single set of features, so results are identical
+    ScoreVector batchScores(featuresList.size(), 0.);
+    double weights(0.);
+
+    for (size_t treeIndex = 0, nTrees = m_rootIndices.size(); treeIndex < nTrees; ++treeIndex)
+    {
+        const double weight(m_weights[treeIndex]);
+        weights += weight;
+
+        for (size_t featuresIndex = 0, nFeatures = featuresList.size(); featuresIndex < nFeatures; ++featuresIndex)
+        {
+            if (this->EvaluateTree(m_rootIndices[treeIndex], featuresList[featuresIndex]))
+            {
+                batchScores[featuresIndex] += weight;
+            }
+            else
+            {
+                batchScores[featuresIndex] -= weight;
+            }
+        }
+    }
+
+    if (weights <= std::numeric_limits<double>::epsilon())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    for (double &score : batchScores)
+        score /= weights;
+
+    scores.swap(batchScores);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode AdaBoostDecisionTree::StrongClassifier::ReadComponent(TiXmlElement *pCurrentXmlElement)
 {
     const std::string componentName(pCurrentXmlElement->ValueStr());
@@ -454,4 +556,55 @@ StatusCode AdaBoostDecisionTree::StrongClassifier::ReadComponent(TiXmlElement *p
     return STATUS_CODE_INVALID_PARAMETER;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::StrongClassifier::CompileWeakClassifiers()
+{
+    m_flatNodeVector.clear();
+    m_rootIndices.clear();
+    m_weights.clear();
+
+    for (const WeakClassifier *const pWeakClassifier : m_weakClassifiers)
+    {
+        m_rootIndices.push_back(pWeakClassifier->CompileNodes(m_flatNodeVector));
+        m_weights.push_back(pWeakClassifier->GetWeight());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool AdaBoostDecisionTree::StrongClassifier::EvaluateTree(const int rootIndex, const LArMvaHelper::MvaFeatureVector &features) const
+{
+    int nodeIndex(rootIndex);
+
+    while (true)
+    {
+        if (nodeIndex < 0)
+            throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+
+        const FlatNode &flatNode(m_flatNodeVector[nodeIndex]);
+
+        if (flatNode.m_isLeaf)
+            return flatNode.m_outcome;
+
+        if (static_cast<int>(features.size()) <= flatNode.m_variableId)
+            throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+        nodeIndex = (features.at(flatNode.m_variableId).Get() <= flatNode.m_threshold) ? flatNode.m_leftIndex : flatNode.m_rightIndex;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AdaBoostDecisionTree::FlatNode::FlatNode(const Node &node) :
+    m_threshold(node.GetThreshold()),
+    m_variableId(node.GetVariableId()),
+    m_leftIndex(-1),
+    m_rightIndex(-1),
+    m_isLeaf(node.IsLeaf()),
+    m_outcome(node.GetOutcome())
+{
+}
+
 } // namespace lar_content
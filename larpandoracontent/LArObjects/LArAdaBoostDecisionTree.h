@@ -27,6 +27,9 @@ namespace lar_content
 class AdaBoostDecisionTree : public MvaInterface
 {
 public:
+    typedef std::vector<LArMvaHelper::MvaFeatureVector> MvaFeatureVectorList;
+    typedef std::vector<double> ScoreVector;
+
     /**
      *  @brief  Constructor.
      */
@@ -88,6 +91,23 @@ public:
      */
     double CalculateProbability(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Calculate the classification scores for many sets of input features, based on the trained model. Each decision tree is
+     *          applied to all sets of features in turn, so that its nodes remain cache-resident.
+     *
+     *  @param  featuresList the list of input features
+     *  @param  scores to receive the classification scores, in the order of the input features
+     */
+    void CalculateClassificationScores(const MvaFeatureVectorList &featuresList, ScoreVector &scores) const;
+
+    /**
+     *  @brief  Calculate the classification probabilities for many sets of input features, based on the trained model
+     *
+     *  @param  featuresList the list of input features
+     *  @param  probabilities to receive the classification probabilities, in the order of the input features
+     */
+    void CalculateProbabilities(const MvaFeatureVectorList &featuresList, ScoreVector &probabilities) const;
+
 private:
     /**
      *  @brief Node class used for representing a decision tree
@@ -190,6 +210,29 @@ private:
 
     typedef std::map<int, const Node *> IdToNodeMap;
 
+    /**
+     *  @brief  FlatNode class, a decision tree node compiled for evaluation, with its children identified by position in a node vector
+     */
+    class FlatNode
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  node the node from which to compile the flat node
+         */
+        FlatNode(const Node &node);
+
+        double m_threshold; ///< Threshold used for decision if decision node
+        int m_variableId;   ///< Variable cut on for decision if decision node
+        int m_leftIndex;    ///< Position of the left child node, or -1 if it is absent from the tree
+        int m_rightIndex;   ///< Position of the right child node, or -1 if it is absent from the tree
+        bool m_isLeaf;      ///< Is node a leaf
+        bool m_outcome;     ///< Outcome if leaf node
+    };
+
+    typedef std::vector<FlatNode> FlatNodeVector;
+
     /**
      *  @brief  WeakClassifier class containing a decision tree and a weight
      */
@@ -223,23 +266,13 @@ private:
         ~WeakClassifier();
 
         /**
-         *  @brief  Predict signal or background based on trained data
-         *
-         *  @param  features the input features
-         *
-         *  @return is signal or background
-         */
-        bool Predict(const LArMvaHelper::MvaFeatureVector &features) const;
-
-        /**
-         *  @brief  Evalute node and return outcome
+         *  @brief  Compile the decision tree, appending its nodes to a flat node vector in breadth-first order from the root node
          *
-         *  @param  nodeId current node id
-         *  @param  features the input features
+         *  @param  flatNodeVector the flat node vector
          *
-         *  @return is signal or background node
+         *  @return the position of the root node in the flat node vector, or -1 if the tree has no root node
          */
-        bool EvaluateNode(const int nodeId, const LArMvaHelper::MvaFeatureVector &features) const;
+        int CompileNodes(FlatNodeVector &flatNodeVector) const;
 
         /**
          *  @brief  Get boost weight for weak classifier
@@ -304,13 +337,39 @@ private:
          */
         double Predict(const LArMvaHelper::MvaFeatureVector &features) const;
 
+        /**
+         *  @brief  Predict signal or background for many sets of input features, based on trained data
+         *
+         *  @param  featuresList the list of input features
+         *  @param  scores to receive the scores produced from trained model, in the order of the input features
+         */
+        void Predict(const MvaFeatureVectorList &featuresList, ScoreVector &scores) const;
+
     private:
         /**
          *  @brief  Read xml element and if weak classifier add to member variables
          */
         pandora::StatusCode ReadComponent(pandora::TiXmlElement *pCurrentXmlElement);
 
+        /**
+         *  @brief  Compile the weak classifiers into a single flat node vector, for evaluation
+         */
+        void CompileWeakClassifiers();
+
+        /**
+         *  @brief  Evaluate a compiled decision tree
+         *
+         *  @param  rootIndex the position of the tree root node in the flat node vector
+         *  @param  features the input features
+         *
+         *  @return is signal or background
+         */
+        bool EvaluateTree(const int rootIndex, const LArMvaHelper::MvaFeatureVector &features) const;
+
         WeakClassifiers m_weakClassifiers; ///< Vector of weak classifers
+        FlatNodeVector m_flatNodeVector;   ///< The nodes of all weak classifiers, compiled for evaluation
+        std::vector<int> m_rootIndices;    ///< The position of the root node of each weak classifier in the flat node vector
+        std::vector<double> m_weights;     ///< The boost weight of each weak classifier
     };
 
     /**
@@ -322,6 +381,13 @@ private:
      */
     double CalculateScore(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Report the cause of an exception thrown when calculating a score
+     *
+     *  @param  statusCodeException the status code exception
+     */
+    static void ReportException(const pandora::StatusCodeException &statusCodeException);
+
     StrongClassifier *m_pStrongClassifier; ///< Strong adaptive boost tree classifier
 };
 
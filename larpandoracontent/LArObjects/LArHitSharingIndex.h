@@ -0,0 +1,164 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArHitSharingIndex.h
+ *
+ *  @brief  Header file for the lar hit sharing index class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_HIT_SHARING_INDEX_H
+#define LAR_HIT_SHARING_INDEX_H 1
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  HitSharingIndex class. Indexes the hit lists of a set of keys (e.g. MC nodes) by hit, so that the keys sharing hits with another
+ *          hit list (e.g. that of a reco node) can be found by visiting each hit of that list once, rather than by intersecting the list
+ *          with the hit list of every key.
+ */
+template <typename KEY, typename HIT>
+class HitSharingIndex
+{
+public:
+    typedef std::vector<KEY> KeyVector;
+    typedef std::pair<unsigned int, unsigned int> KeyIndexAndCount;
+    typedef std::vector<KeyIndexAndCount> KeyIndexAndCountVector;
+
+    /**
+     *  @brief  Add a key and its hit list to the index, the key being given the next key index
+     *
+     *  @param  key the key
+     *  @param  hitList the hit list of the key, in which a hit may appear more than once
+     */
+    template <typename HIT_LIST>
+    void AddKey(const KEY &key, const HIT_LIST &hitList);
+
+    /**
+     *  @brief  Get the keys, in order of key index
+     *
+     *  @return the keys
+     */
+    const KeyVector &GetKeys() const;
+
+    /**
+     *  @brief  Get the number of hits shared between a hit list and each key with which it shares any hits. As for a set intersection of
+     *          sorted lists, a hit repeated in both lists counts up to the lesser of its two multiplicities.
+     *
+     *  @param  hitList the hit list, in which any repeated hits must be adjacent (e.g. a sorted list)
+     *  @param  sharedHitCounts to receive the key index and shared hit count for each key, in order of the first shared hit, replacing any
+     *          previous contents
+     */
+    template <typename HIT_LIST>
+    void GetSharedHitCounts(const HIT_LIST &hitList, KeyIndexAndCountVector &sharedHitCounts) const;
+
+    /**
+     *  @brief  Invoke a callable for each hit in a hit list and each key whose hit list contains it, in hit list order. As for a search of
+     *          the hit list of each key for each hit, a hit repeated in the hit list is visited once per repeat, whereas repeats within the
+     *          hit list of a key make no difference.
+     *
+     *  @param  hitList the hit list
+     *  @param  visitor the callable, invoked with the key index and the hit
+     */
+    template <typename HIT_LIST, typename VISITOR>
+    void ForEachSharedHit(const HIT_LIST &hitList, const VISITOR &visitor) const;
+
+private:
+    typedef std::unordered_map<HIT, KeyIndexAndCountVector> HitToKeysMap;
+
+    KeyVector m_keys;            ///< The keys, in order of key index
+    HitToKeysMap m_hitToKeysMap; ///< The map from each hit to the index of each key whose hit list contains it, and its multiplicity there
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename HIT>
+template <typename HIT_LIST>
+inline void HitSharingIndex<KEY, HIT>::AddKey(const KEY &key, const HIT_LIST &hitList)
+{
+    const unsigned int keyIndex(m_keys.size());
+    m_keys.push_back(key);
+
+    for (const HIT &hit : hitList)
+    {
+        KeyIndexAndCountVector &keyIndices(m_hitToKeysMap[hit]);
+
+        // ATTN The hits of each key are added together, so a repeated hit of this key can only be the last entry for the hit
+        if (!keyIndices.empty() && (keyIndex == keyIndices.back().first))
+        {
+            ++keyIndices.back().second;
+        }
+        else
+        {
+            keyIndices.emplace_back(keyIndex, 1);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename HIT>
+inline const typename HitSharingIndex<KEY, HIT>::KeyVector &HitSharingIndex<KEY, HIT>::GetKeys() const
+{
+    return m_keys;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename HIT>
+template <typename HIT_LIST>
+inline void HitSharingIndex<KEY, HIT>::GetSharedHitCounts(const HIT_LIST &hitList, KeyIndexAndCountVector &sharedHitCounts) const
+{
+    sharedHitCounts.clear();
+    std::unordered_map<unsigned int, unsigned int> keyIndexToPositionMap;
+
+    for (auto iter = hitList.begin(); iter != hitList.end();)
+    {
+        const HIT hit(*iter);
+        unsigned int nCopies(0);
+
+        for (; (hitList.end() != iter) && (hit == *iter); ++iter)
+            ++nCopies;
+
+        const typename HitToKeysMap::const_iterator mapIter(m_hitToKeysMap.find(hit));
+
+        if (m_hitToKeysMap.end() == mapIter)
+            continue;
+
+        for (const KeyIndexAndCount &keyIndexAndCount : mapIter->second)
+        {
+            const auto positionIter(keyIndexToPositionMap.emplace(keyIndexAndCount.first, sharedHitCounts.size()).first);
+
+            if (sharedHitCounts.size() == positionIter->second)
+                sharedHitCounts.emplace_back(keyIndexAndCount.first, 0);
+
+            sharedHitCounts.at(positionIter->second).second += std::min(nCopies, keyIndexAndCount.second);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename HIT>
+template <typename HIT_LIST, typename VISITOR>
+inline void HitSharingIndex<KEY, HIT>::ForEachSharedHit(const HIT_LIST &hitList, const VISITOR &visitor) const
+{
+    for (const HIT &hit : hitList)
+    {
+        const typename HitToKeysMap::const_iterator mapIter(m_hitToKeysMap.find(hit));
+
+        if (m_hitToKeysMap.end() == mapIter)
+            continue;
+
+        for (const KeyIndexAndCount &keyIndexAndCount : mapIter->second)
+            visitor(keyIndexAndCount.first, hit);
+    }
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_HIT_SHARING_INDEX_H
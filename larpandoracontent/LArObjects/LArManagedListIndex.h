@@ -0,0 +1,100 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArManagedListIndex.h
+ *
+ *  @brief  Header file for the lar managed list index class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_MANAGED_LIST_INDEX_H
+#define LAR_MANAGED_LIST_INDEX_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <unordered_set>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ManagedListIndex class. Provides constant time membership checks against a snapshot of a managed list (e.g. the current cluster
+ *          list), in place of linear searches through the list itself. The owning algorithm must record any objects it deletes (e.g. via
+ *          merges) while the index is in use, so that deleted objects are flagged as absent.
+ */
+template <typename T>
+class ManagedListIndex
+{
+public:
+    typedef MANAGED_CONTAINER<const T *> ObjectList;
+
+    /**
+     *  @brief  Rebuild the index from a managed list
+     *
+     *  @param  objectList the managed list to index
+     */
+    void Reset(const ObjectList &objectList);
+
+    /**
+     *  @brief  Clear the index
+     */
+    void Clear();
+
+    /**
+     *  @brief  Whether an object is present in the indexed list
+     *
+     *  @param  pT address of the object
+     *
+     *  @return boolean
+     */
+    bool IsPresent(const T *const pT) const;
+
+    /**
+     *  @brief  Record the removal of an object from the indexed list, e.g. its deletion in a merge
+     *
+     *  @param  pT address of the object
+     */
+    void RemoveObject(const T *const pT);
+
+private:
+    typedef std::unordered_set<const T *> ObjectSet;
+
+    ObjectSet m_objectSet; ///< The objects in the indexed list
+};
+
+typedef ManagedListIndex<pandora::Cluster> ClusterListIndex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ManagedListIndex<T>::Reset(const ObjectList &objectList)
+{
+    m_objectSet.clear();
+    m_objectSet.insert(objectList.begin(), objectList.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ManagedListIndex<T>::Clear()
+{
+    m_objectSet.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline bool ManagedListIndex<T>::IsPresent(const T *const pT) const
+{
+    return (m_objectSet.count(pT) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ManagedListIndex<T>::RemoveObject(const T *const pT)
+{
+    m_objectSet.erase(pT);
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_MANAGED_LIST_INDEX_H
@@ -0,0 +1,156 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArMvaFeatureMatrix.cc
+ *
+ *  @brief  Implementation of the lar mva feature matrix class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArObjects/LArMvaFeatureMatrix.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+MvaFeatureMatrix::MvaFeatureMatrix(const StringVector &featureNames) :
+    m_featureNames(featureNames),
+    m_nFeatures(featureNames.size()),
+    m_nMaskWordsPerRow((featureNames.size() + 63) / 64),
+    m_nRows(0)
+{
+    for (unsigned int featureIndex = 0; featureIndex < m_nFeatures; ++featureIndex)
+    {
+        if (!m_featureIndexMap.insert(FeatureIndexMap::value_type(m_featureNames.at(featureIndex), featureIndex)).second)
+            throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int MvaFeatureMatrix::GetFeatureIndex(const std::string &featureName) const
+{
+    const FeatureIndexMap::const_iterator iter(m_featureIndexMap.find(featureName));
+
+    if (m_featureIndexMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int MvaFeatureMatrix::AddRow()
+{
+    m_values.resize(m_values.size() + m_nFeatures, 0.);
+    m_validityMasks.resize(m_validityMasks.size() + m_nMaskWordsPerRow, 0);
+
+    return m_nRows++;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MvaFeatureMatrix::SetFeature(const unsigned int row, const unsigned int featureIndex, const double value)
+{
+    this->CheckIndices(row, featureIndex);
+
+    m_values[row * m_nFeatures + featureIndex] = value;
+    m_validityMasks[row * m_nMaskWordsPerRow + featureIndex / 64] |= (uint64_t(1) << (featureIndex % 64));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MvaFeatureMatrix::SetFeatures(const unsigned int row, const MvaTypes::MvaFeatureVector &featureVector)
+{
+    if (featureVector.size() != m_nFeatures)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    for (unsigned int featureIndex = 0; featureIndex < m_nFeatures; ++featureIndex)
+    {
+        if (featureVector[featureIndex].IsInitialized())
+            this->SetFeature(row, featureIndex, featureVector[featureIndex].Get());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool MvaFeatureMatrix::IsFeatureValid(const unsigned int row, const unsigned int featureIndex) const
+{
+    this->CheckIndices(row, featureIndex);
+
+    return ((m_validityMasks[row * m_nMaskWordsPerRow + featureIndex / 64] >> (featureIndex % 64)) & 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool MvaFeatureMatrix::IsRowValid(const unsigned int row) const
+{
+    if (row >= m_nRows)
+        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+
+    const uint64_t *const pMasks(m_validityMasks.data() + row * m_nMaskWordsPerRow);
+
+    for (unsigned int word = 0; word < m_nMaskWordsPerRow; ++word)
+    {
+        const unsigned int nBits(((word + 1) * 64 <= m_nFeatures) ? 64 : (m_nFeatures % 64));
+        const uint64_t fullMask((nBits == 64) ? ~uint64_t(0) : ((uint64_t(1) << nBits) - 1));
+
+        if (pMasks[word] != fullMask)
+            return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double MvaFeatureMatrix::GetFeature(const unsigned int row, const unsigned int featureIndex) const
+{
+    if (!this->IsFeatureValid(row, featureIndex))
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    return m_values[row * m_nFeatures + featureIndex];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MvaFeatureMatrix::GetFeatureVector(const unsigned int row, MvaTypes::MvaFeatureVector &featureVector) const
+{
+    if (row >= m_nRows)
+        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+
+    featureVector.reserve(featureVector.size() + m_nFeatures);
+
+    for (unsigned int featureIndex = 0; featureIndex < m_nFeatures; ++featureIndex)
+    {
+        if (this->IsFeatureValid(row, featureIndex))
+        {
+            featureVector.emplace_back(m_values[row * m_nFeatures + featureIndex]);
+        }
+        else
+        {
+            featureVector.emplace_back();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MvaFeatureMatrix::Clear()
+{
+    m_values.clear();
+    m_validityMasks.clear();
+    m_nRows = 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MvaFeatureMatrix::CheckIndices(const unsigned int row, const unsigned int featureIndex) const
+{
+    if ((row >= m_nRows) || (featureIndex >= m_nFeatures))
+        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+}
+
+} // namespace lar_content
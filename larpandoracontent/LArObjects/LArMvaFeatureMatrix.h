@@ -0,0 +1,178 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArMvaFeatureMatrix.h
+ *
+ *  @brief  Header file for the lar mva feature matrix class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_MVA_FEATURE_MATRIX_H
+#define LAR_MVA_FEATURE_MATRIX_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include "larpandoracontent/LArObjects/LArMvaInterface.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  MvaFeatureMatrix class. Holds the mva features for a set of candidates (e.g. all the slices in an event) in a single flat array,
+ *          one row per candidate and one column per named feature. The feature names are resolved to column indices once, on construction,
+ *          and the validity of each entry is recorded in a bitmask, rather than alongside each value.
+ */
+class MvaFeatureMatrix
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  featureNames the ordered names of the features, defining the columns of the matrix
+     */
+    MvaFeatureMatrix(const pandora::StringVector &featureNames);
+
+    /**
+     *  @brief  Get the ordered names of the features
+     *
+     *  @return the feature names
+     */
+    const pandora::StringVector &GetFeatureNames() const;
+
+    /**
+     *  @brief  Get the column index of a named feature
+     *
+     *  @param  featureName the feature name
+     *
+     *  @return the column index
+     */
+    unsigned int GetFeatureIndex(const std::string &featureName) const;
+
+    /**
+     *  @brief  Get the number of features, i.e. columns
+     *
+     *  @return the number of features
+     */
+    unsigned int GetNFeatures() const;
+
+    /**
+     *  @brief  Get the number of rows
+     *
+     *  @return the number of rows
+     */
+    unsigned int GetNRows() const;
+
+    /**
+     *  @brief  Add a row, with all features initially invalid
+     *
+     *  @return the index of the new row
+     */
+    unsigned int AddRow();
+
+    /**
+     *  @brief  Set the value of a feature
+     *
+     *  @param  row the row index
+     *  @param  featureIndex the feature column index
+     *  @param  value the feature value
+     */
+    void SetFeature(const unsigned int row, const unsigned int featureIndex, const double value);
+
+    /**
+     *  @brief  Set the values of all the features in a row from a feature vector, ordered as the columns of the matrix
+     *
+     *  @param  row the row index
+     *  @param  featureVector the feature vector, uninitialized features of which are recorded as invalid
+     */
+    void SetFeatures(const unsigned int row, const MvaTypes::MvaFeatureVector &featureVector);
+
+    /**
+     *  @brief  Whether a feature has been set
+     *
+     *  @param  row the row index
+     *  @param  featureIndex the feature column index
+     *
+     *  @return boolean
+     */
+    bool IsFeatureValid(const unsigned int row, const unsigned int featureIndex) const;
+
+    /**
+     *  @brief  Whether all the features in a row have been set
+     *
+     *  @param  row the row index
+     *
+     *  @return boolean
+     */
+    bool IsRowValid(const unsigned int row) const;
+
+    /**
+     *  @brief  Get the value of a feature
+     *
+     *  @param  row the row index
+     *  @param  featureIndex the feature column index
+     *
+     *  @return the feature value
+     */
+    double GetFeature(const unsigned int row, const unsigned int featureIndex) const;
+
+    /**
+     *  @brief  Append the features in a row to a feature vector, e.g. for use with an mva interface
+     *
+     *  @param  row the row index
+     *  @param  featureVector the feature vector to receive the features, any invalid features being left uninitialized
+     */
+    void GetFeatureVector(const unsigned int row, MvaTypes::MvaFeatureVector &featureVector) const;
+
+    /**
+     *  @brief  Remove all rows, retaining the feature names and the allocated storage
+     */
+    void Clear();
+
+private:
+    typedef std::unordered_map<std::string, unsigned int> FeatureIndexMap;
+    typedef std::vector<uint64_t> ValidityMaskVector;
+
+    /**
+     *  @brief  Check that a row and feature column index lie within the matrix
+     *
+     *  @param  row the row index
+     *  @param  featureIndex the feature column index
+     */
+    void CheckIndices(const unsigned int row, const unsigned int featureIndex) const;
+
+    pandora::StringVector m_featureNames; ///< The ordered feature names
+    FeatureIndexMap m_featureIndexMap;    ///< The map from feature name to column index
+    unsigned int m_nFeatures;             ///< The number of features, i.e. columns
+    unsigned int m_nMaskWordsPerRow;      ///< The number of validity mask words per row
+    unsigned int m_nRows;                 ///< The number of rows
+    std::vector<double> m_values;         ///< The feature values, row-major
+    ValidityMaskVector m_validityMasks;   ///< The feature validity bitmasks, row-major
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::StringVector &MvaFeatureMatrix::GetFeatureNames() const
+{
+    return m_featureNames;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int MvaFeatureMatrix::GetNFeatures() const
+{
+    return m_nFeatures;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int MvaFeatureMatrix::GetNRows() const
+{
+    return m_nRows;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_MVA_FEATURE_MATRIX_H
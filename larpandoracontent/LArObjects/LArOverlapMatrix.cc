@@ -29,16 +29,46 @@ namespace lar_content
 template <typename T>
 void OverlapMatrix<T>::GetUnambiguousElements(const bool ignoreUnavailable, ElementList &elementList) const
 {
+    // ATTN The connected elements need only be collected once for each distinct set of explored clusters. A set explored from one key
+    // cluster is closed under navigation, so exploring from any key cluster it contains yields the same set if and only if the sizes match
+    std::unordered_map<const Cluster *, unsigned int> keyClusterToGroupMap;
+    std::vector<std::pair<size_t, ClusterVector>> groupVector;
+
     for (typename TheMatrix::const_iterator iter1 = this->begin(), iter1End = this->end(); iter1 != iter1End; ++iter1)
     {
-        ElementList tempElementList;
-        ClusterList clusterList1, clusterList2;
-        this->GetConnectedElements(iter1->first, ignoreUnavailable, tempElementList, clusterList1, clusterList2);
+        ClusterList localClusterList1, localClusterList2;
+        ClusterSet exploredClusters;
+        this->ExploreConnections(iter1->first, ignoreUnavailable, localClusterList1, localClusterList2, exploredClusters);
+
+        const auto groupIter(keyClusterToGroupMap.find(iter1->first));
+
+        if ((keyClusterToGroupMap.end() == groupIter) || (groupVector.at(groupIter->second).first != exploredClusters.size()))
+        {
+            ElementList tempElementList;
+            ClusterList clusterList1, clusterList2;
+            this->CollectConnectedElements(exploredClusters, ignoreUnavailable, tempElementList, clusterList1, clusterList2);
+
+            ClusterVector unambiguousClusters;
+            const Cluster *pCluster1(nullptr), *pCluster2(nullptr);
+
+            if (this->DefaultAmbiguityFunction(clusterList1, clusterList2, pCluster1, pCluster2))
+                unambiguousClusters = {pCluster1, pCluster2};
 
-        const Cluster *pCluster1(nullptr), *pCluster2(nullptr);
-        if (!this->DefaultAmbiguityFunction(clusterList1, clusterList2, pCluster1, pCluster2))
+            keyClusterToGroupMap[iter1->first] = groupVector.size();
+
+            for (const Cluster *const pExploredCluster1 : localClusterList1)
+                keyClusterToGroupMap[pExploredCluster1] = groupVector.size();
+
+            groupVector.emplace_back(exploredClusters.size(), unambiguousClusters);
+        }
+
+        const ClusterVector &unambiguousClusters(groupVector.at(keyClusterToGroupMap.at(iter1->first)).second);
+
+        if (unambiguousClusters.empty())
             continue;
 
+        const Cluster *const pCluster1(unambiguousClusters.at(0)), *const pCluster2(unambiguousClusters.at(1));
+
         // ATTN With HIT_CUSTOM definitions, it is possible to navigate from different view 1 clusters to same combination
         if (iter1->first != pCluster1)
             continue;
@@ -143,47 +173,31 @@ void OverlapMatrix<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 {
     ClusterList additionalRemovals;
 
-    if (m_clusterNavigationMap12.erase(pCluster) > 0)
+    // ATTN The 1->2 and 2->1 navigation maps are the reverse of one another, so the navigation list of the cluster identifies the matrix
+    // entries and navigation lists referring to it, and there is no need to scan the full matrix or navigation maps
+    if (m_clusterNavigationMap12.count(pCluster))
     {
         typename TheMatrix::iterator iter = m_overlapMatrix.find(pCluster);
 
         if (m_overlapMatrix.end() != iter)
             m_overlapMatrix.erase(iter);
 
-        for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMap21.begin(); navIter != m_clusterNavigationMap21.end();)
-        {
-            ClusterNavigationMap::iterator thisIter = navIter++;
-            ClusterList::iterator listIter = std::find(thisIter->second.begin(), thisIter->second.end(), pCluster);
-
-            if (thisIter->second.end() != listIter)
-                thisIter->second.erase(listIter);
-
-            if (thisIter->second.empty())
-                additionalRemovals.push_back(thisIter->first);
-        }
+        this->RemoveNavigationLists(pCluster, m_clusterNavigationMap12, m_clusterNavigationMap21, additionalRemovals);
     }
 
-    if (m_clusterNavigationMap21.erase(pCluster) > 0)
+    const ClusterNavigationMap::const_iterator navIter21(m_clusterNavigationMap21.find(pCluster));
+
+    if (m_clusterNavigationMap21.end() != navIter21)
     {
-        for (typename TheMatrix::iterator iter1 = m_overlapMatrix.begin(), iter1End = m_overlapMatrix.end(); iter1 != iter1End; ++iter1)
+        for (const Cluster *const pCluster1 : navIter21->second)
         {
-            typename OverlapList::iterator iter = iter1->second.find(pCluster);
+            typename TheMatrix::iterator iter1 = m_overlapMatrix.find(pCluster1);
 
-            if (iter1->second.end() != iter)
-                iter1->second.erase(iter);
+            if (m_overlapMatrix.end() != iter1)
+                iter1->second.erase(pCluster);
         }
 
-        for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMap12.begin(); navIter != m_clusterNavigationMap12.end();)
-        {
-            ClusterNavigationMap::iterator thisIter = navIter++;
-            ClusterList::iterator listIter = std::find(thisIter->second.begin(), thisIter->second.end(), pCluster);
-
-            if (thisIter->second.end() != listIter)
-                thisIter->second.erase(listIter);
-
-            if (thisIter->second.empty())
-                additionalRemovals.push_back(thisIter->first);
-        }
+        this->RemoveNavigationLists(pCluster, m_clusterNavigationMap21, m_clusterNavigationMap12, additionalRemovals);
     }
 
     additionalRemovals.sort(LArClusterHelper::SortByNHits);
@@ -199,16 +213,27 @@ void OverlapMatrix<T>::GetConnectedElements(const Cluster *const pCluster, const
     ClusterList &clusterList1, ClusterList &clusterList2) const
 {
     ClusterList localClusterList1, localClusterList2;
-    this->ExploreConnections(pCluster, ignoreUnavailable, localClusterList1, localClusterList2);
+    ClusterSet exploredClusters;
+    this->ExploreConnections(pCluster, ignoreUnavailable, localClusterList1, localClusterList2, exploredClusters);
+    this->CollectConnectedElements(exploredClusters, ignoreUnavailable, elementList, clusterList1, clusterList2);
+}
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapMatrix<T>::CollectConnectedElements(const ClusterSet &exploredClusters, const bool ignoreUnavailable, ElementList &elementList,
+    ClusterList &clusterList1, ClusterList &clusterList2) const
+{
     // ATTN Now need to check that all clusters received are from fully available matrix elements
     elementList.clear();
     clusterList1.clear();
     clusterList2.clear();
 
+    ClusterSet clusterSet1, clusterSet2;
+
     for (typename TheMatrix::const_iterator iter1 = this->begin(), iter1End = this->end(); iter1 != iter1End; ++iter1)
     {
-        if (localClusterList1.end() == std::find(localClusterList1.begin(), localClusterList1.end(), iter1->first))
+        if (!exploredClusters.count(iter1->first))
             continue;
 
         for (typename OverlapList::const_iterator iter2 = iter1->second.begin(), iter2End = iter1->second.end(); iter2 != iter2End; ++iter2)
@@ -219,9 +244,9 @@ void OverlapMatrix<T>::GetConnectedElements(const Cluster *const pCluster, const
             Element element(iter1->first, iter2->first, iter2->second);
             elementList.push_back(element);
 
-            if (clusterList1.end() == std::find(clusterList1.begin(), clusterList1.end(), iter1->first))
+            if (clusterSet1.insert(iter1->first).second)
                 clusterList1.push_back(iter1->first);
-            if (clusterList2.end() == std::find(clusterList2.begin(), clusterList2.end(), iter2->first))
+            if (clusterSet2.insert(iter2->first).second)
                 clusterList2.push_back(iter2->first);
         }
     }
@@ -232,8 +257,8 @@ void OverlapMatrix<T>::GetConnectedElements(const Cluster *const pCluster, const
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-void OverlapMatrix<T>::ExploreConnections(
-    const Cluster *const pCluster, const bool ignoreUnavailable, ClusterList &clusterList1, ClusterList &clusterList2) const
+void OverlapMatrix<T>::ExploreConnections(const Cluster *const pCluster, const bool ignoreUnavailable, ClusterList &clusterList1,
+    ClusterList &clusterList2, ClusterSet &exploredClusters) const
 {
     if (ignoreUnavailable && !pCluster->IsAvailable())
         return;
@@ -250,7 +275,7 @@ void OverlapMatrix<T>::ExploreConnections(
     ClusterList &clusterList(clusterFromView1 ? clusterList1 : clusterList2);
     const ClusterNavigationMap &navigationMap(clusterFromView1 ? m_clusterNavigationMap12 : m_clusterNavigationMap21);
 
-    if (clusterList.end() != std::find(clusterList.begin(), clusterList.end(), pCluster))
+    if (!exploredClusters.insert(pCluster).second)
         return;
 
     clusterList.push_back(pCluster);
@@ -260,7 +285,37 @@ void OverlapMatrix<T>::ExploreConnections(
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
     for (ClusterList::const_iterator cIter = iter->second.begin(), cIterEnd = iter->second.end(); cIter != cIterEnd; ++cIter)
-        this->ExploreConnections(*cIter, ignoreUnavailable, clusterList1, clusterList2);
+        this->ExploreConnections(*cIter, ignoreUnavailable, clusterList1, clusterList2, exploredClusters);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapMatrix<T>::RemoveNavigationLists(
+    const Cluster *const pCluster, ClusterNavigationMap &navigationMap, ClusterNavigationMap &reverseNavigationMap, ClusterList &additionalRemovals)
+{
+    ClusterNavigationMap::iterator navIter = navigationMap.find(pCluster);
+
+    if (navigationMap.end() == navIter)
+        return;
+
+    for (const Cluster *const pTargetCluster : navIter->second)
+    {
+        ClusterNavigationMap::iterator reverseIter = reverseNavigationMap.find(pTargetCluster);
+
+        if (reverseNavigationMap.end() == reverseIter)
+            continue;
+
+        ClusterList::iterator listIter = std::find(reverseIter->second.begin(), reverseIter->second.end(), pCluster);
+
+        if (reverseIter->second.end() != listIter)
+            reverseIter->second.erase(listIter);
+
+        if (reverseIter->second.empty())
+            additionalRemovals.push_back(pTargetCluster);
+    }
+
+    navigationMap.erase(navIter);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
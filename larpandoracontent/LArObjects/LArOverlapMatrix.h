@@ -232,9 +232,33 @@ private:
      *  @param  pCluster address of the cluster
      *  @param  clusterList1 connected view 1 clusters
      *  @param  clusterList2 connected view 2 clusters
+     *  @param  exploredClusters the clusters already explored, in either view
      */
     void ExploreConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, pandora::ClusterList &clusterList1,
-        pandora::ClusterList &clusterList2) const;
+        pandora::ClusterList &clusterList2, pandora::ClusterSet &exploredClusters) const;
+
+    /**
+     *  @brief  Collect the elements, and the clusters in each view, associated with a set of explored clusters
+     *
+     *  @param  exploredClusters the clusters reached when exploring the connections of a cluster
+     *  @param  ignoreUnavailable whether to ignore unavailable clusters
+     *  @param  elementList to receive the connected element list
+     *  @param  clusterList1 connected view 1 clusters
+     *  @param  clusterList2 connected view 2 clusters
+     */
+    void CollectConnectedElements(const pandora::ClusterSet &exploredClusters, const bool ignoreUnavailable, ElementList &elementList,
+        pandora::ClusterList &clusterList1, pandora::ClusterList &clusterList2) const;
+
+    /**
+     *  @brief  Remove the navigation list of a cluster, and remove the cluster from the navigation lists in the opposite direction
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  navigationMap the navigation map holding the navigation list of the cluster
+     *  @param  reverseNavigationMap the navigation map in the opposite direction
+     *  @param  additionalRemovals to receive the clusters whose navigation lists become empty
+     */
+    void RemoveNavigationLists(const pandora::Cluster *const pCluster, ClusterNavigationMap &navigationMap,
+        ClusterNavigationMap &reverseNavigationMap, pandora::ClusterList &additionalRemovals);
 
     TheMatrix m_overlapMatrix;                     ///< The overlap matrix
     ClusterNavigationMap m_clusterNavigationMap12; ///< The cluster navigation map 1->2
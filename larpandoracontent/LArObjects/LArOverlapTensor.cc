@@ -41,16 +41,46 @@ const Cluster *OverlapTensor<T>::Element::GetCluster(const HitType hitType) cons
 template <typename T>
 void OverlapTensor<T>::GetUnambiguousElements(const bool ignoreUnavailable, ElementList &elementList) const
 {
+    // ATTN The connected elements need only be collected once for each distinct set of explored clusters. A set explored from one key
+    // cluster is closed under navigation, so exploring from any key cluster it contains yields the same set if and only if the sizes match
+    std::unordered_map<const Cluster *, unsigned int> keyClusterToGroupMap;
+    std::vector<std::pair<size_t, ClusterVector>> groupVector;
+
     for (typename TheTensor::const_iterator iterU = this->begin(), iterUEnd = this->end(); iterU != iterUEnd; ++iterU)
     {
-        ElementList tempElementList;
-        ClusterList clusterListU, clusterListV, clusterListW;
-        this->GetConnectedElements(iterU->first, ignoreUnavailable, tempElementList, clusterListU, clusterListV, clusterListW);
+        ClusterList localClusterListU, localClusterListV, localClusterListW;
+        ClusterSet exploredClusters;
+        this->ExploreConnections(iterU->first, ignoreUnavailable, localClusterListU, localClusterListV, localClusterListW, exploredClusters);
+
+        const auto groupIter(keyClusterToGroupMap.find(iterU->first));
+
+        if ((keyClusterToGroupMap.end() == groupIter) || (groupVector.at(groupIter->second).first != exploredClusters.size()))
+        {
+            ElementList tempElementList;
+            ClusterList clusterListU, clusterListV, clusterListW;
+            this->CollectConnectedElements(exploredClusters, ignoreUnavailable, tempElementList, clusterListU, clusterListV, clusterListW);
+
+            ClusterVector unambiguousClusters;
+            const Cluster *pClusterU(nullptr), *pClusterV(nullptr), *pClusterW(nullptr);
+
+            if (this->DefaultAmbiguityFunction(clusterListU, clusterListV, clusterListW, pClusterU, pClusterV, pClusterW))
+                unambiguousClusters = {pClusterU, pClusterV, pClusterW};
+
+            keyClusterToGroupMap[iterU->first] = groupVector.size();
+
+            for (const Cluster *const pExploredClusterU : localClusterListU)
+                keyClusterToGroupMap[pExploredClusterU] = groupVector.size();
+
+            groupVector.emplace_back(exploredClusters.size(), unambiguousClusters);
+        }
 
-        const Cluster *pClusterU(nullptr), *pClusterV(nullptr), *pClusterW(nullptr);
-        if (!this->DefaultAmbiguityFunction(clusterListU, clusterListV, clusterListW, pClusterU, pClusterV, pClusterW))
+        const ClusterVector &unambiguousClusters(groupVector.at(keyClusterToGroupMap.at(iterU->first)).second);
+
+        if (unambiguousClusters.empty())
             continue;
 
+        const Cluster *const pClusterU(unambiguousClusters.at(0)), *const pClusterV(unambiguousClusters.at(1)), *const pClusterW(unambiguousClusters.at(2));
+
         // ATTN With HIT_CUSTOM definitions, it is possible to navigate from different U clusters to same combination
         if (iterU->first != pClusterU)
             continue;
@@ -133,11 +163,20 @@ void OverlapTensor<T>::SetOverlapResult(const pandora::Cluster *const pClusterU,
     ClusterList &navigationWU(m_clusterNavigationMapWU[pClusterW]);
 
     if (navigationUV.end() == std::find(navigationUV.begin(), navigationUV.end(), pClusterV))
+    {
         navigationUV.push_back(pClusterV);
+        m_clusterNavigationMapVU[pClusterV].push_back(pClusterU);
+    }
     if (navigationVW.end() == std::find(navigationVW.begin(), navigationVW.end(), pClusterW))
+    {
         navigationVW.push_back(pClusterW);
+        m_clusterNavigationMapWV[pClusterW].push_back(pClusterV);
+    }
     if (navigationWU.end() == std::find(navigationWU.begin(), navigationWU.end(), pClusterU))
+    {
         navigationWU.push_back(pClusterU);
+        m_clusterNavigationMapUW[pClusterU].push_back(pClusterW);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -171,73 +210,67 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 {
     ClusterList additionalRemovals;
 
-    if (m_clusterNavigationMapUV.erase(pCluster) > 0)
+    // ATTN The reverse navigation maps identify the navigation lists and tensor entries referring to the cluster, so there is no need
+    // to scan the full tensor or navigation maps. The reverse map for the cluster's own view must be read before it is modified.
+    if (this->RemoveNavigationList(pCluster, m_clusterNavigationMapUV, m_clusterNavigationMapVU))
     {
         typename TheTensor::iterator iter = m_overlapTensor.find(pCluster);
 
         if (m_overlapTensor.end() != iter)
             m_overlapTensor.erase(iter);
 
-        for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMapWU.begin(); navIter != m_clusterNavigationMapWU.end();)
-        {
-            ClusterNavigationMap::iterator thisIter = navIter++;
-            ClusterList::iterator listIter = std::find(thisIter->second.begin(), thisIter->second.end(), pCluster);
-
-            if (thisIter->second.end() != listIter)
-                thisIter->second.erase(listIter);
-
-            if (thisIter->second.empty())
-                additionalRemovals.push_back(thisIter->first);
-        }
+        this->RemoveFromNavigationLists(pCluster, m_clusterNavigationMapWU, m_clusterNavigationMapUW, additionalRemovals);
     }
 
-    if (m_clusterNavigationMapVW.erase(pCluster) > 0)
+    if (m_clusterNavigationMapVW.count(pCluster))
     {
-        for (typename TheTensor::iterator iterU = m_overlapTensor.begin(), iterUEnd = m_overlapTensor.end(); iterU != iterUEnd; ++iterU)
-        {
-            typename OverlapMatrix::iterator iter = iterU->second.find(pCluster);
-
-            if (iterU->second.end() != iter)
-                iterU->second.erase(iter);
-        }
+        const ClusterNavigationMap::const_iterator reverseIter(m_clusterNavigationMapVU.find(pCluster));
 
-        for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMapUV.begin(); navIter != m_clusterNavigationMapUV.end();)
+        if (m_clusterNavigationMapVU.end() != reverseIter)
         {
-            ClusterNavigationMap::iterator thisIter = navIter++;
-            ClusterList::iterator listIter = std::find(thisIter->second.begin(), thisIter->second.end(), pCluster);
-
-            if (thisIter->second.end() != listIter)
-                thisIter->second.erase(listIter);
+            for (const Cluster *const pClusterU : reverseIter->second)
+            {
+                typename TheTensor::iterator iterU = m_overlapTensor.find(pClusterU);
 
-            if (thisIter->second.empty())
-                additionalRemovals.push_back(thisIter->first);
+                if (m_overlapTensor.end() != iterU)
+                    iterU->second.erase(pCluster);
+            }
         }
+
+        this->RemoveNavigationList(pCluster, m_clusterNavigationMapVW, m_clusterNavigationMapWV);
+        this->RemoveFromNavigationLists(pCluster, m_clusterNavigationMapUV, m_clusterNavigationMapVU, additionalRemovals);
     }
 
-    if (m_clusterNavigationMapWU.erase(pCluster) > 0)
+    if (m_clusterNavigationMapWU.count(pCluster))
     {
-        for (typename TheTensor::iterator iterU = m_overlapTensor.begin(), iterUEnd = m_overlapTensor.end(); iterU != iterUEnd; ++iterU)
+        const ClusterNavigationMap::const_iterator reverseIterW(m_clusterNavigationMapWV.find(pCluster));
+
+        if (m_clusterNavigationMapWV.end() != reverseIterW)
         {
-            for (typename OverlapMatrix::iterator iterV = iterU->second.begin(), iterVEnd = iterU->second.end(); iterV != iterVEnd; ++iterV)
+            for (const Cluster *const pClusterV : reverseIterW->second)
             {
-                typename OverlapList::iterator iter = iterV->second.find(pCluster);
+                const ClusterNavigationMap::const_iterator reverseIterV(m_clusterNavigationMapVU.find(pClusterV));
 
-                if (iterV->second.end() != iter)
-                    iterV->second.erase(iter);
-            }
-        }
+                if (m_clusterNavigationMapVU.end() == reverseIterV)
+                    continue;
 
-        for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMapVW.begin(); navIter != m_clusterNavigationMapVW.end();)
-        {
-            ClusterNavigationMap::iterator thisIter = navIter++;
-            ClusterList::iterator listIter = std::find(thisIter->second.begin(), thisIter->second.end(), pCluster);
+                for (const Cluster *const pClusterU : reverseIterV->second)
+                {
+                    typename TheTensor::iterator iterU = m_overlapTensor.find(pClusterU);
+
+                    if (m_overlapTensor.end() == iterU)
+                        continue;
 
-            if (thisIter->second.end() != listIter)
-                thisIter->second.erase(listIter);
+                    typename OverlapMatrix::iterator iterV = iterU->second.find(pClusterV);
 
-            if (thisIter->second.empty())
-                additionalRemovals.push_back(thisIter->first);
+                    if (iterU->second.end() != iterV)
+                        iterV->second.erase(pCluster);
+                }
+            }
         }
+
+        this->RemoveNavigationList(pCluster, m_clusterNavigationMapWU, m_clusterNavigationMapUW);
+        this->RemoveFromNavigationLists(pCluster, m_clusterNavigationMapVW, m_clusterNavigationMapWV, additionalRemovals);
     }
 
     additionalRemovals.sort(LArClusterHelper::SortByNHits);
@@ -253,17 +286,28 @@ void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const
     ClusterList &clusterListU, ClusterList &clusterListV, ClusterList &clusterListW) const
 {
     ClusterList localClusterListU, localClusterListV, localClusterListW;
-    this->ExploreConnections(pCluster, ignoreUnavailable, localClusterListU, localClusterListV, localClusterListW);
+    ClusterSet exploredClusters;
+    this->ExploreConnections(pCluster, ignoreUnavailable, localClusterListU, localClusterListV, localClusterListW, exploredClusters);
+    this->CollectConnectedElements(exploredClusters, ignoreUnavailable, elementList, clusterListU, clusterListV, clusterListW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void OverlapTensor<T>::CollectConnectedElements(const ClusterSet &exploredClusters, const bool ignoreUnavailable, ElementList &elementList,
+    ClusterList &clusterListU, ClusterList &clusterListV, ClusterList &clusterListW) const
+{
     // ATTN Now need to check that all clusters received are from fully available tensor elements
     elementList.clear();
     clusterListU.clear();
     clusterListV.clear();
     clusterListW.clear();
 
+    ClusterSet clusterSetU, clusterSetV, clusterSetW;
+
     for (typename TheTensor::const_iterator iterU = this->begin(), iterUEnd = this->end(); iterU != iterUEnd; ++iterU)
     {
-        if (localClusterListU.end() == std::find(localClusterListU.begin(), localClusterListU.end(), iterU->first))
+        if (!exploredClusters.count(iterU->first))
             continue;
 
         for (typename OverlapMatrix::const_iterator iterV = iterU->second.begin(), iterVEnd = iterU->second.end(); iterV != iterVEnd; ++iterV)
@@ -276,11 +320,11 @@ void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const
                 Element element(iterU->first, iterV->first, iterW->first, iterW->second);
                 elementList.push_back(element);
 
-                if (clusterListU.end() == std::find(clusterListU.begin(), clusterListU.end(), iterU->first))
+                if (clusterSetU.insert(iterU->first).second)
                     clusterListU.push_back(iterU->first);
-                if (clusterListV.end() == std::find(clusterListV.begin(), clusterListV.end(), iterV->first))
+                if (clusterSetV.insert(iterV->first).second)
                     clusterListV.push_back(iterV->first);
-                if (clusterListW.end() == std::find(clusterListW.begin(), clusterListW.end(), iterW->first))
+                if (clusterSetW.insert(iterW->first).second)
                     clusterListW.push_back(iterW->first);
             }
         }
@@ -293,7 +337,7 @@ void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const
 
 template <typename T>
 void OverlapTensor<T>::ExploreConnections(const Cluster *const pCluster, const bool ignoreUnavailable, ClusterList &clusterListU,
-    ClusterList &clusterListV, ClusterList &clusterListW) const
+    ClusterList &clusterListV, ClusterList &clusterListW, ClusterSet &exploredClusters) const
 {
     if (ignoreUnavailable && !pCluster->IsAvailable())
         return;
@@ -307,7 +351,7 @@ void OverlapTensor<T>::ExploreConnections(const Cluster *const pCluster, const b
     const ClusterNavigationMap &navigationMap(
         (TPC_VIEW_U == hitType) ? m_clusterNavigationMapUV : (TPC_VIEW_V == hitType) ? m_clusterNavigationMapVW : m_clusterNavigationMapWU);
 
-    if (clusterList.end() != std::find(clusterList.begin(), clusterList.end(), pCluster))
+    if (!exploredClusters.insert(pCluster).second)
         return;
 
     clusterList.push_back(pCluster);
@@ -317,7 +361,68 @@ void OverlapTensor<T>::ExploreConnections(const Cluster *const pCluster, const b
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
     for (ClusterList::const_iterator cIter = iter->second.begin(), cIterEnd = iter->second.end(); cIter != cIterEnd; ++cIter)
-        this->ExploreConnections(*cIter, ignoreUnavailable, clusterListU, clusterListV, clusterListW);
+        this->ExploreConnections(*cIter, ignoreUnavailable, clusterListU, clusterListV, clusterListW, exploredClusters);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapTensor<T>::RemoveFromNavigationLists(const Cluster *const pCluster, ClusterNavigationMap &navigationMap,
+    ClusterNavigationMap &reverseNavigationMap, ClusterList &additionalRemovals)
+{
+    ClusterNavigationMap::iterator reverseIter = reverseNavigationMap.find(pCluster);
+
+    if (reverseNavigationMap.end() == reverseIter)
+        return;
+
+    for (const Cluster *const pNavigatingCluster : reverseIter->second)
+    {
+        ClusterNavigationMap::iterator navIter = navigationMap.find(pNavigatingCluster);
+
+        if (navigationMap.end() == navIter)
+            continue;
+
+        ClusterList::iterator listIter = std::find(navIter->second.begin(), navIter->second.end(), pCluster);
+
+        if (navIter->second.end() != listIter)
+            navIter->second.erase(listIter);
+
+        if (navIter->second.empty())
+            additionalRemovals.push_back(pNavigatingCluster);
+    }
+
+    reverseNavigationMap.erase(reverseIter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool OverlapTensor<T>::RemoveNavigationList(const Cluster *const pCluster, ClusterNavigationMap &navigationMap, ClusterNavigationMap &reverseNavigationMap)
+{
+    ClusterNavigationMap::iterator navIter = navigationMap.find(pCluster);
+
+    if (navigationMap.end() == navIter)
+        return false;
+
+    for (const Cluster *const pTargetCluster : navIter->second)
+    {
+        ClusterNavigationMap::iterator reverseIter = reverseNavigationMap.find(pTargetCluster);
+
+        if (reverseNavigationMap.end() == reverseIter)
+            continue;
+
+        ClusterList::iterator listIter = std::find(reverseIter->second.begin(), reverseIter->second.end(), pCluster);
+
+        if (reverseIter->second.end() != listIter)
+            reverseIter->second.erase(listIter);
+
+        if (reverseIter->second.empty())
+            reverseNavigationMap.erase(reverseIter);
+    }
+
+    navigationMap.erase(navIter);
+
+    return true;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
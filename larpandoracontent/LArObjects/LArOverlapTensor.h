@@ -275,6 +275,19 @@ private:
     void GetConnectedElements(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, ElementList &elementList,
         pandora::ClusterList &clusterListU, pandora::ClusterList &clusterListV, pandora::ClusterList &clusterListW) const;
 
+    /**
+     *  @brief  Collect the elements, and the clusters in each view, associated with a set of explored clusters
+     *
+     *  @param  exploredClusters the clusters reached when exploring the connections of a cluster
+     *  @param  ignoreUnavailable whether to ignore unavailable clusters
+     *  @param  elementList to receive the connected element list
+     *  @param  clusterListU connected u clusters
+     *  @param  clusterListV connected v clusters
+     *  @param  clusterListW connected w clusters
+     */
+    void CollectConnectedElements(const pandora::ClusterSet &exploredClusters, const bool ignoreUnavailable, ElementList &elementList,
+        pandora::ClusterList &clusterListU, pandora::ClusterList &clusterListV, pandora::ClusterList &clusterListW) const;
+
     /**
      *  @brief  Explore connections associated with a given cluster
      *
@@ -282,14 +295,40 @@ private:
      *  @param  clusterListU connected u clusters
      *  @param  clusterListV connected v clusters
      *  @param  clusterListW connected w clusters
+     *  @param  exploredClusters the clusters already explored, in any view
      */
     void ExploreConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, pandora::ClusterList &clusterListU,
-        pandora::ClusterList &clusterListV, pandora::ClusterList &clusterListW) const;
+        pandora::ClusterList &clusterListV, pandora::ClusterList &clusterListW, pandora::ClusterSet &exploredClusters) const;
+
+    /**
+     *  @brief  Remove a cluster from the navigation lists that contain it, using the reverse navigation map to find those lists
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  navigationMap the navigation map whose lists may contain the cluster
+     *  @param  reverseNavigationMap the reverse of the navigation map
+     *  @param  additionalRemovals to receive the clusters whose navigation lists become empty
+     */
+    void RemoveFromNavigationLists(const pandora::Cluster *const pCluster, ClusterNavigationMap &navigationMap,
+        ClusterNavigationMap &reverseNavigationMap, pandora::ClusterList &additionalRemovals);
+
+    /**
+     *  @brief  Remove the navigation list of a cluster, and the corresponding entries in the reverse navigation map
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  navigationMap the navigation map holding the navigation list of the cluster
+     *  @param  reverseNavigationMap the reverse of the navigation map
+     *
+     *  @return whether the cluster had a navigation list
+     */
+    bool RemoveNavigationList(const pandora::Cluster *const pCluster, ClusterNavigationMap &navigationMap, ClusterNavigationMap &reverseNavigationMap);
 
     TheTensor m_overlapTensor;                     ///< The overlap tensor
     ClusterNavigationMap m_clusterNavigationMapUV; ///< The cluster navigation map U->V
     ClusterNavigationMap m_clusterNavigationMapVW; ///< The cluster navigation map V->W
     ClusterNavigationMap m_clusterNavigationMapWU; ///< The cluster navigation map W->U
+    ClusterNavigationMap m_clusterNavigationMapVU; ///< The reverse cluster navigation map V->U, i.e. the U clusters navigating to each V cluster
+    ClusterNavigationMap m_clusterNavigationMapWV; ///< The reverse cluster navigation map W->V, i.e. the V clusters navigating to each W cluster
+    ClusterNavigationMap m_clusterNavigationMapUW; ///< The reverse cluster navigation map U->W, i.e. the W clusters navigating to each U cluster
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -403,6 +442,9 @@ inline void OverlapTensor<T>::Clear()
     m_clusterNavigationMapUV.clear();
     m_clusterNavigationMapVW.clear();
     m_clusterNavigationMapWU.clear();
+    m_clusterNavigationMapVU.clear();
+    m_clusterNavigationMapWV.clear();
+    m_clusterNavigationMapUW.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -10,6 +10,9 @@
 
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace pandora;
 
 namespace lar_content
@@ -74,6 +77,19 @@ StatusCode SupportVectorMachine::Initialize(const std::string &parameterLocation
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
+    m_supportVectorMatrix.clear();
+    m_yAlphaVector.clear();
+    m_supportVectorMatrix.reserve(m_svInfoList.size() * m_nFeatures);
+    m_yAlphaVector.reserve(m_svInfoList.size());
+
+    for (const SupportVectorInfo &svInfo : m_svInfoList)
+    {
+        for (const LArMvaHelper::MvaFeature &value : svInfo.m_supportVector)
+            m_supportVectorMatrix.push_back(value.Get());
+
+        m_yAlphaVector.push_back(svInfo.m_yAlpha);
+    }
+
     m_isInitialized = true;
     return STATUS_CODE_SUCCESS;
 }
@@ -247,19 +263,79 @@ StatusCode SupportVectorMachine::ReadSupportVector(const TiXmlHandle &currentHan
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper::MvaFeatureVector &features) const
+void SupportVectorMachine::CalculateClassificationScores(const MvaFeatureVectorList &featuresList, ScoreVector &scores) const
 {
-    if (!m_isInitialized)
+    this->CheckClassificationReady();
+
+    bool useDenseKernel(true);
+
+    for (const LArMvaHelper::MvaFeatureVector &features : featuresList)
+        useDenseKernel = useDenseKernel && this->CanUseDenseKernel(features);
+
+    ScoreVector batchScores;
+    batchScores.reserve(featuresList.size());
+
+    if (!useDenseKernel)
     {
-        std::cout << "SupportVectorMachine: could not perform classification because the svm was uninitialized" << std::endl;
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+        for (const LArMvaHelper::MvaFeatureVector &features : featuresList)
+            batchScores.push_back(this->CalculateClassificationScoreImpl(features));
+
+        scores.swap(batchScores);
+        return;
     }
 
-    if (m_svInfoList.empty())
+    DoubleVector featureMatrix(featuresList.size() * m_nFeatures);
+
+    for (std::size_t set = 0; set < featuresList.size(); ++set)
+        this->FillDenseFeatures(featuresList.at(set), featuresList.size(), featureMatrix.data() + set);
+
+    batchScores.resize(featuresList.size(), 0.);
+    this->AccumulateDenseScores(featureMatrix.data(), featuresList.size(), batchScores.data());
+
+    for (double &score : batchScores)
+        score += m_bias;
+
+    scores.swap(batchScores);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::CalculateProbabilities(const MvaFeatureVectorList &featuresList, ScoreVector &probabilities) const
+{
+    if (!m_enableProbability)
     {
-        std::cout << "SupportVectorMachine: could not perform classification because the initialized svm had no support vectors in the model"
-                  << std::endl;
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+        std::cout << "LArSupportVectorMachine: cannot calculate probabilities for this SVM" << std::endl;
+        throw STATUS_CODE_NOT_INITIALIZED;
+    }
+
+    ScoreVector scores;
+    this->CalculateClassificationScores(featuresList, scores);
+
+    // ATTN: Apply the same logistic map as for a single set of features
+    for (double &score : scores)
+    {
+        const double scaledScore = m_probAParameter * score + m_probBParameter;
+        score = 1. / (1. + std::exp(scaledScore));
+    }
+
+    probabilities.swap(scores);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper::MvaFeatureVector &features) const
+{
+    this->CheckClassificationReady();
+
+    if (this->CanUseDenseKernel(features))
+    {
+        DoubleVector denseFeatures(m_nFeatures);
+        this->FillDenseFeatures(features, 1, denseFeatures.data());
+
+        double classScore(0.);
+        this->AccumulateDenseScores(denseFeatures.data(), 1, &classScore);
+
+        return classScore + m_bias;
     }
 
     LArMvaHelper::MvaFeatureVector standardizedFeatures;
@@ -281,4 +357,121 @@ double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper
     return classScore + m_bias;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::CheckClassificationReady() const
+{
+    if (!m_isInitialized)
+    {
+        std::cout << "SupportVectorMachine: could not perform classification because the svm was uninitialized" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+
+    if (m_svInfoList.empty())
+    {
+        std::cout << "SupportVectorMachine: could not perform classification because the initialized svm had no support vectors in the model"
+                  << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool SupportVectorMachine::CanUseDenseKernel(const LArMvaHelper::MvaFeatureVector &features) const
+{
+    // ATTN Unstandardized features are passed to the kernel as they are, so the generic path handles any unexpected number of features
+    return ((USER_DEFINED != m_kernelType) && (m_standardizeFeatures || (features.size() == m_nFeatures)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::FillDenseFeatures(const LArMvaHelper::MvaFeatureVector &features, const std::size_t stride, double *const pDenseFeatures) const
+{
+    for (std::size_t i = 0; i < m_nFeatures; ++i)
+    {
+        pDenseFeatures[i * stride] =
+            m_standardizeFeatures ? m_featureInfoList.at(i).StandardizeParameter(features.at(i).Get()) : features.at(i).Get();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::AccumulateDenseScores(const double *const pFeatureMatrix, const std::size_t nFeatureSets, double *const pScores) const
+{
+    switch (m_kernelType)
+    {
+        case LINEAR:
+            return this->AccumulateDenseScores<LINEAR>(pFeatureMatrix, nFeatureSets, pScores);
+        case QUADRATIC:
+            return this->AccumulateDenseScores<QUADRATIC>(pFeatureMatrix, nFeatureSets, pScores);
+        case CUBIC:
+            return this->AccumulateDenseScores<CUBIC>(pFeatureMatrix, nFeatureSets, pScores);
+        case GAUSSIAN_RBF:
+            return this->AccumulateDenseScores<GAUSSIAN_RBF>(pFeatureMatrix, nFeatureSets, pScores);
+        default:
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <SupportVectorMachine::KernelType KERNEL_TYPE>
+void SupportVectorMachine::AccumulateDenseScores(const double *const pFeatureMatrix, const std::size_t nFeatureSets, double *const pScores) const
+{
+    // ATTN Each kernel matches the arithmetic of its generic counterpart term by term, and each score is accumulated over the features and
+    // support vectors in the same order, so the scores are identical to those from the generic kernel functions. The feature matrix is
+    // feature-major, so the innermost loops run over independent sets of features and can be vectorised without reordering any sum.
+    const double denominator(m_scaleFactor * m_scaleFactor);
+
+    if ((GAUSSIAN_RBF != KERNEL_TYPE) && (denominator < std::numeric_limits<double>::epsilon()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    DoubleVector totals(nFeatureSets);
+    double *const pTotals(totals.data());
+
+    for (std::size_t sv = 0, nSupportVectors = m_yAlphaVector.size(); sv < nSupportVectors; ++sv)
+    {
+        const double *const pSupportVector(m_supportVectorMatrix.data() + sv * m_nFeatures);
+        std::fill(totals.begin(), totals.end(), 0.);
+
+        for (std::size_t i = 0; i < m_nFeatures; ++i)
+        {
+            const double supportValue(pSupportVector[i]);
+            const double *const pFeatureValues(pFeatureMatrix + i * nFeatureSets);
+
+            for (std::size_t set = 0; set < nFeatureSets; ++set)
+            {
+                if constexpr (GAUSSIAN_RBF == KERNEL_TYPE)
+                {
+                    const double difference(supportValue - pFeatureValues[set]);
+                    pTotals[set] += difference * difference;
+                }
+                else
+                {
+                    pTotals[set] += supportValue * pFeatureValues[set];
+                }
+            }
+        }
+
+        const double yAlpha(m_yAlphaVector[sv]);
+
+        for (std::size_t set = 0; set < nFeatureSets; ++set)
+        {
+            if constexpr (GAUSSIAN_RBF == KERNEL_TYPE)
+            {
+                pScores[set] += yAlpha * std::exp(-m_scaleFactor * pTotals[set]);
+            }
+            else if constexpr (LINEAR == KERNEL_TYPE)
+            {
+                pScores[set] += yAlpha * (pTotals[set] / denominator);
+            }
+            else
+            {
+                const double total(pTotals[set] / denominator + 1.);
+                pScores[set] += yAlpha * ((QUADRATIC == KERNEL_TYPE) ? total * total : total * total * total);
+            }
+        }
+    }
+}
+
 } // namespace lar_content
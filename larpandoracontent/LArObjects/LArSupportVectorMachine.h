@@ -31,6 +31,8 @@ class SupportVectorMachine : public MvaInterface
 {
 public:
     typedef std::function<double(const LArMvaHelper::MvaFeatureVector &, const LArMvaHelper::MvaFeatureVector &, const double)> KernelFunction;
+    typedef std::vector<LArMvaHelper::MvaFeatureVector> MvaFeatureVectorList;
+    typedef std::vector<double> ScoreVector;
 
     /**
      *  @brief  KernelType enum
@@ -86,6 +88,23 @@ public:
      */
     double CalculateProbability(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Calculate the classification scores for many sets of input features, based on the trained model. For the built-in kernels,
+     *          the standardized features are gathered into a dense matrix and scored against each support vector in turn.
+     *
+     *  @param  featuresList the list of input features
+     *  @param  scores to receive the classification scores, in the order of the input features
+     */
+    void CalculateClassificationScores(const MvaFeatureVectorList &featuresList, ScoreVector &scores) const;
+
+    /**
+     *  @brief  Calculate the classification probabilities for many sets of input features, based on the trained model
+     *
+     *  @param  featuresList the list of input features
+     *  @param  probabilities to receive the classification probabilities, in the order of the input features
+     */
+    void CalculateProbabilities(const MvaFeatureVectorList &featuresList, ScoreVector &probabilities) const;
+
     /**
      *  @brief  Query whether this svm is initialized
      *
@@ -101,7 +120,7 @@ public:
     unsigned int GetNFeatures() const;
 
     /**
-     *  @brief  Set the kernel function to use
+     *  @brief  Set the kernel function to use, which will be treated as user-defined
      *
      *  @param  kernelFunction the kernel function
      */
@@ -162,6 +181,7 @@ private:
     typedef std::vector<FeatureInfo> FeatureInfoVector;
 
     typedef std::map<KernelType, KernelFunction> KernelMap;
+    typedef std::vector<double> DoubleVector;
 
     bool m_isInitialized; ///< Whether this svm has been initialized
 
@@ -181,6 +201,9 @@ private:
     KernelFunction m_kernelFunction; ///< The kernel function
     KernelMap m_kernelMap;           ///< Map from the kernel types to the kernel functions
 
+    DoubleVector m_supportVectorMatrix; ///< The support vectors, as a dense row-major matrix with one row per support vector
+    DoubleVector m_yAlphaVector;        ///< The alpha-value multiplied by the y-value for each support vector
+
     /**
      *  @brief  Read the svm parameters from an xml file
      *
@@ -234,6 +257,48 @@ private:
      */
     double CalculateClassificationScoreImpl(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Check that the svm is ready to perform classification
+     */
+    void CheckClassificationReady() const;
+
+    /**
+     *  @brief  Whether a set of input features can be scored using the dense support vector matrix and a built-in kernel
+     *
+     *  @param  features the vector of features
+     *
+     *  @return boolean
+     */
+    bool CanUseDenseKernel(const LArMvaHelper::MvaFeatureVector &features) const;
+
+    /**
+     *  @brief  Write a set of input features, standardized if required, to a column of a dense feature-major matrix
+     *
+     *  @param  features the vector of features
+     *  @param  stride the number of sets of features in the matrix
+     *  @param  pDenseFeatures the address of the first element of the column
+     */
+    void FillDenseFeatures(const LArMvaHelper::MvaFeatureVector &features, const std::size_t stride, double *const pDenseFeatures) const;
+
+    /**
+     *  @brief  Accumulate the kernel-weighted support vector sums, excluding the bias, for a dense feature-major matrix of input features
+     *
+     *  @param  pFeatureMatrix the address of the feature matrix, with one column per set of features
+     *  @param  nFeatureSets the number of sets of features
+     *  @param  pScores the address of the scores to which to add the sums
+     */
+    void AccumulateDenseScores(const double *const pFeatureMatrix, const std::size_t nFeatureSets, double *const pScores) const;
+
+    /**
+     *  @brief  Accumulate the kernel-weighted support vector sums using a built-in kernel, specialised at compile time
+     *
+     *  @param  pFeatureMatrix the address of the feature matrix, with one column per set of features
+     *  @param  nFeatureSets the number of sets of features
+     *  @param  pScores the address of the scores to which to add the sums
+     */
+    template <KernelType KERNEL_TYPE>
+    void AccumulateDenseScores(const double *const pFeatureMatrix, const std::size_t nFeatureSets, double *const pScores) const;
+
     /**
      *  @brief  An inhomogeneous quadratic kernel
      *
@@ -332,6 +397,7 @@ inline unsigned int SupportVectorMachine::GetNFeatures() const
 
 inline void SupportVectorMachine::SetKernelFunction(KernelFunction kernelFunction)
 {
+    m_kernelType = USER_DEFINED;
     m_kernelFunction = std::move(kernelFunction);
 }
 
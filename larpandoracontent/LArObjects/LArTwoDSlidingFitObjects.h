@@ -10,8 +10,12 @@
 
 #include "Pandora/StatusCodes.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <map>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace lar_content
@@ -30,6 +34,147 @@ enum TransverseDirection
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  LayerIndexedMap class. A sorted map from layer to value, offering the subset of the std::map interface used by the sliding fits.
+ *          The entries are held contiguously, in layer order, and a dense table indexed by layer offset gives O(1) look-up. Entries are
+ *          appended in O(1) when inserted in increasing layer order, whilst any other insertion is O(n). Iterators are invalidated by insertion.
+ */
+template <typename T>
+class LayerIndexedMap
+{
+public:
+    typedef int key_type;
+    typedef T mapped_type;
+    typedef std::pair<int, T> value_type;
+    typedef std::vector<value_type> EntryVector;
+    typedef typename EntryVector::const_iterator const_iterator;
+    typedef typename EntryVector::const_reverse_iterator const_reverse_iterator;
+    typedef const_iterator iterator;
+    typedef const_reverse_iterator reverse_iterator;
+
+    /**
+     *  @brief  Default constructor
+     */
+    LayerIndexedMap();
+
+    /**
+     *  @brief  Whether the map is empty
+     *
+     *  @return boolean
+     */
+    bool empty() const;
+
+    /**
+     *  @brief  Get the number of entries
+     *
+     *  @return the number of entries
+     */
+    size_t size() const;
+
+    /**
+     *  @brief  Get an iterator to the entry for the lowest layer
+     *
+     *  @return the iterator
+     */
+    const_iterator begin() const;
+
+    /**
+     *  @brief  Get the past-the-end iterator
+     *
+     *  @return the iterator
+     */
+    const_iterator end() const;
+
+    /**
+     *  @brief  Get a reverse iterator to the entry for the highest layer
+     *
+     *  @return the reverse iterator
+     */
+    const_reverse_iterator rbegin() const;
+
+    /**
+     *  @brief  Get the past-the-end reverse iterator
+     *
+     *  @return the reverse iterator
+     */
+    const_reverse_iterator rend() const;
+
+    /**
+     *  @brief  Find the entry for a layer
+     *
+     *  @param  layer the layer
+     *
+     *  @return an iterator to the entry, or end() if there is no entry for the layer
+     */
+    const_iterator find(const int layer) const;
+
+    /**
+     *  @brief  Get the number of entries for a layer
+     *
+     *  @param  layer the layer
+     *
+     *  @return one if there is an entry for the layer, otherwise zero
+     */
+    size_t count(const int layer) const;
+
+    /**
+     *  @brief  Get the value for a layer, throwing std::out_of_range if there is no entry for the layer
+     *
+     *  @param  layer the layer
+     *
+     *  @return the value
+     */
+    const T &at(const int layer) const;
+
+    /**
+     *  @brief  Get the value for a layer, inserting a default-constructed value if there is no entry for the layer
+     *
+     *  @param  layer the layer
+     *
+     *  @return the value
+     */
+    T &operator[](const int layer);
+
+    /**
+     *  @brief  Insert an entry, if there is no existing entry for its layer
+     *
+     *  @param  entry the entry
+     *
+     *  @return an iterator to the entry for the layer and whether the entry was inserted
+     */
+    std::pair<const_iterator, bool> insert(const value_type &entry);
+
+    /**
+     *  @brief  Remove all entries
+     */
+    void clear();
+
+private:
+    /**
+     *  @brief  Get the index of the entry for a layer
+     *
+     *  @param  layer the layer
+     *
+     *  @return the index of the entry, or -1 if there is no entry for the layer
+     */
+    int GetIndex(const int layer) const;
+
+    /**
+     *  @brief  Insert an entry for a layer with no existing entry
+     *
+     *  @param  entry the entry
+     *
+     *  @return the index of the inserted entry
+     */
+    int InsertNew(const value_type &entry);
+
+    EntryVector m_entries;         ///< The entries, in layer order
+    std::vector<int> m_indexTable; ///< The index of the entry for each layer, offset by the minimum layer (-1 for layers without entries)
+    int m_minLayer;                ///< The layer corresponding to the start of the index table
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  class LayerFitResult
  */
@@ -81,7 +226,7 @@ private:
     double m_rms;      ///< The rms of the fit residuals
 };
 
-typedef std::map<int, LayerFitResult> LayerFitResultMap;
+typedef LayerIndexedMap<LayerFitResult> LayerFitResultMap;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -155,7 +300,7 @@ private:
     unsigned int m_nPoints; ///< The number of points used
 };
 
-typedef std::map<int, LayerFitContribution> LayerFitContributionMap;
+typedef LayerIndexedMap<LayerFitContribution> LayerFitContributionMap;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -292,6 +437,183 @@ typedef std::vector<FitSegment> FitSegmentList;
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline LayerIndexedMap<T>::LayerIndexedMap() : m_minLayer(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline bool LayerIndexedMap<T>::empty() const
+{
+    return m_entries.empty();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline size_t LayerIndexedMap<T>::size() const
+{
+    return m_entries.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline typename LayerIndexedMap<T>::const_iterator LayerIndexedMap<T>::begin() const
+{
+    return m_entries.begin();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline typename LayerIndexedMap<T>::const_iterator LayerIndexedMap<T>::end() const
+{
+    return m_entries.end();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline typename LayerIndexedMap<T>::const_reverse_iterator LayerIndexedMap<T>::rbegin() const
+{
+    return m_entries.rbegin();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline typename LayerIndexedMap<T>::const_reverse_iterator LayerIndexedMap<T>::rend() const
+{
+    return m_entries.rend();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline typename LayerIndexedMap<T>::const_iterator LayerIndexedMap<T>::find(const int layer) const
+{
+    const int index(this->GetIndex(layer));
+    return ((index < 0) ? m_entries.end() : m_entries.begin() + index);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline size_t LayerIndexedMap<T>::count(const int layer) const
+{
+    return ((this->GetIndex(layer) < 0) ? 0 : 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline const T &LayerIndexedMap<T>::at(const int layer) const
+{
+    const int index(this->GetIndex(layer));
+
+    if (index < 0)
+        throw std::out_of_range("LayerIndexedMap::at");
+
+    return m_entries[index].second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline T &LayerIndexedMap<T>::operator[](const int layer)
+{
+    int index(this->GetIndex(layer));
+
+    if (index < 0)
+        index = this->InsertNew(value_type(layer, T()));
+
+    return m_entries[index].second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline std::pair<typename LayerIndexedMap<T>::const_iterator, bool> LayerIndexedMap<T>::insert(const value_type &entry)
+{
+    const int index(this->GetIndex(entry.first));
+
+    if (index >= 0)
+        return std::make_pair(m_entries.begin() + index, false);
+
+    return std::make_pair(m_entries.begin() + this->InsertNew(entry), true);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void LayerIndexedMap<T>::clear()
+{
+    m_entries.clear();
+    m_indexTable.clear();
+    m_minLayer = 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline int LayerIndexedMap<T>::GetIndex(const int layer) const
+{
+    const int offset(layer - m_minLayer);
+
+    if ((offset < 0) || (offset >= static_cast<int>(m_indexTable.size())))
+        return -1;
+
+    return m_indexTable[offset];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline int LayerIndexedMap<T>::InsertNew(const value_type &entry)
+{
+    const int layer(entry.first);
+
+    if (m_entries.empty())
+    {
+        m_minLayer = layer;
+        m_indexTable.assign(1, 0);
+        m_entries.push_back(entry);
+        return 0;
+    }
+
+    // Usual case, appending in increasing layer order
+    if (layer > m_entries.back().first)
+    {
+        const int index(static_cast<int>(m_entries.size()));
+        m_indexTable.resize(layer - m_minLayer + 1, -1);
+        m_indexTable[layer - m_minLayer] = index;
+        m_entries.push_back(entry);
+        return index;
+    }
+
+    if (layer < m_minLayer)
+    {
+        m_indexTable.insert(m_indexTable.begin(), m_minLayer - layer, -1);
+        m_minLayer = layer;
+    }
+
+    const typename EntryVector::iterator insertIter(std::lower_bound(
+        m_entries.begin(), m_entries.end(), layer, [](const value_type &existingEntry, const int value) { return existingEntry.first < value; }));
+    const int index(static_cast<int>(insertIter - m_entries.begin()));
+    m_entries.insert(insertIter, entry);
+
+    for (int iEntry = index; iEntry < static_cast<int>(m_entries.size()); ++iEntry)
+        m_indexTable[m_entries[iEntry].first - m_minLayer] = iEntry;
+
+    return index;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline LayerFitResult::LayerFitResult(const double l, const double fitT, const double gradient, const double rms) :
     m_l(l),
     m_fitT(fitT),
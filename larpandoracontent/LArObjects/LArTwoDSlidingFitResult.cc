@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <limits>
 
 using namespace pandora;
@@ -630,12 +631,34 @@ void TwoDSlidingFitResult::FillLayerFitContributionMap(const CartesianPointVecto
     if (!m_layerFitContributionMap.empty())
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
-    for (CartesianPointVector::const_iterator iter = coordinateVector.begin(), iterEnd = coordinateVector.end(); iter != iterEnd; ++iter)
+    if (coordinateVector.empty())
+        return;
+
+    std::vector<float> rLVector(coordinateVector.size()), rTVector(coordinateVector.size());
+    std::vector<int> layerVector(coordinateVector.size());
+
+    for (unsigned int iPoint = 0; iPoint < coordinateVector.size(); ++iPoint)
+    {
+        this->GetLocalPosition(coordinateVector[iPoint], rLVector[iPoint], rTVector[iPoint]);
+        layerVector[iPoint] = this->GetLayer(rLVector[iPoint]);
+    }
+
+    // ATTN Create the occupied layers in increasing order, so that each is appended to the contribution map, then add points in input order
+    const int minLayer(*std::min_element(layerVector.begin(), layerVector.end()));
+    const int maxLayer(*std::max_element(layerVector.begin(), layerVector.end()));
+    std::vector<bool> isOccupied(maxLayer - minLayer + 1, false);
+
+    for (const int layer : layerVector)
+        isOccupied[layer - minLayer] = true;
+
+    for (int layer = minLayer; layer <= maxLayer; ++layer)
     {
-        float rL(0.f), rT(0.f);
-        this->GetLocalPosition(*iter, rL, rT);
-        m_layerFitContributionMap[this->GetLayer(rL)].AddPoint(rL, rT);
+        if (isOccupied[layer - minLayer])
+            (void)m_layerFitContributionMap.insert(LayerFitContributionMap::value_type(layer, LayerFitContribution()));
     }
+
+    for (unsigned int iPoint = 0; iPoint < coordinateVector.size(); ++iPoint)
+        m_layerFitContributionMap[layerVector[iPoint]].AddPoint(rLVector[iPoint], rTVector[iPoint]);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -996,16 +1019,8 @@ StatusCode TwoDSlidingFitResult::GetLongitudinalSurroundingLayers(
     if (m_layerFitResultMap.end() == firstLayerIter)
         return STATUS_CODE_NOT_FOUND;
 
-    // Second layer iterator
-    secondLayerIter = m_layerFitResultMap.end();
-
-    for (int iLayer = startLayer + 1; iLayer <= maxLayer; ++iLayer)
-    {
-        secondLayerIter = m_layerFitResultMap.find(iLayer);
-
-        if (m_layerFitResultMap.end() != secondLayerIter)
-            break;
-    }
+    // Second layer iterator, the next entry in layer order, as the first layer is the last entry at or below the start layer
+    secondLayerIter = std::next(firstLayerIter);
 
     if (m_layerFitResultMap.end() == secondLayerIter)
         return STATUS_CODE_NOT_FOUND;
@@ -272,6 +272,20 @@ void LArRotationalTransformationPlugin::GetMinChiSquaredYZ(const double u, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArRotationalTransformationPlugin::GetMinChiSquaredYZ(const std::size_t nPoints, const double *const pU, const double *const pV,
+    const double *const pW, const double *const pSigmaU, const double *const pSigmaV, const double *const pSigmaW, const double *const pUFit,
+    const double *const pVFit, const double *const pWFit, const double sigmaFit, double *const pY, double *const pZ, double *const pChiSquared) const
+{
+    // ATTN Qualified calls bypass virtual dispatch, allowing the (branch-free) single-point calculation to be inlined and vectorised
+    for (std::size_t iPoint = 0; iPoint < nPoints; ++iPoint)
+    {
+        LArRotationalTransformationPlugin::GetMinChiSquaredYZ(pU[iPoint], pV[iPoint], pW[iPoint], pSigmaU[iPoint], pSigmaV[iPoint],
+            pSigmaW[iPoint], pUFit[iPoint], pVFit[iPoint], pWFit[iPoint], sigmaFit, pY[iPoint], pZ[iPoint], pChiSquared[iPoint]);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode LArRotationalTransformationPlugin::Initialize()
 {
     const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
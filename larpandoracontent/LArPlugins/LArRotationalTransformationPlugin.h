@@ -10,6 +10,8 @@
 
 #include "Plugins/LArTransformationPlugin.h"
 
+#include <cstddef>
+
 namespace lar_content
 {
 
@@ -44,6 +46,31 @@ public:
     virtual void GetMinChiSquaredYZ(const double u, const double v, const double w, const double sigmaU, const double sigmaV, const double sigmaW,
         const double uFit, const double vFit, const double wFit, const double sigmaFit, double &y, double &z, double &chiSquared) const;
 
+    /**
+     *  @brief  Get the y and z positions that minimise the chi-squared, including the deviation from a fit position, for a batch of points,
+     *          held in structure-of-arrays form. Each point gives exactly the result of the corresponding single-point method, but without a
+     *          virtual call per point.
+     *
+     *  @param  nPoints the number of points
+     *  @param  pU address of the array of u values
+     *  @param  pV address of the array of v values
+     *  @param  pW address of the array of w values
+     *  @param  pSigmaU address of the array of u uncertainties
+     *  @param  pSigmaV address of the array of v uncertainties
+     *  @param  pSigmaW address of the array of w uncertainties
+     *  @param  pUFit address of the array of fit u values
+     *  @param  pVFit address of the array of fit v values
+     *  @param  pWFit address of the array of fit w values
+     *  @param  sigmaFit the fit uncertainty, common to all points
+     *  @param  pY address of the array to receive the y values
+     *  @param  pZ address of the array to receive the z values
+     *  @param  pChiSquared address of the array to receive the chi-squared values
+     */
+    void GetMinChiSquaredYZ(const std::size_t nPoints, const double *const pU, const double *const pV, const double *const pW,
+        const double *const pSigmaU, const double *const pSigmaV, const double *const pSigmaW, const double *const pUFit,
+        const double *const pVFit, const double *const pWFit, const double sigmaFit, double *const pY, double *const pZ,
+        double *const pChiSquared) const;
+
 private:
     pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -50,16 +50,28 @@ void DeltaRayMatchingContainers::FillHitToClusterMap(const ClusterList &inputClu
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void DeltaRayMatchingContainers::AddToClusterMap(const Cluster *const pCluster)
+void DeltaRayMatchingContainers::AddToClusterMap(const Cluster *const pCluster, const bool shouldUpdateKDTree)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
     HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU : (hitType == TPC_VIEW_V) ? m_hitToClusterMapV : m_hitToClusterMapW);
+    HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
 
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
     for (const CaloHit *const pCaloHit : caloHitList)
-        hitToClusterMap[pCaloHit] = pCluster;
+    {
+        const auto insertResult(hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster)));
+
+        if (!insertResult.second)
+        {
+            insertResult.first->second = pCluster;
+        }
+        else if (shouldUpdateKDTree)
+        {
+            kdTree.insert(HitKDNode2D(pCaloHit, pCaloHit->GetPositionVector().GetX(), pCaloHit->GetPositionVector().GetZ()));
+        }
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -168,8 +180,9 @@ void DeltaRayMatchingContainers::AddClustersToPfoMaps(const ParticleFlowObject *
 
 void DeltaRayMatchingContainers::AddClustersToContainers(const ClusterVector &newClusterVector, const PfoVector &pfoVector)
 {
+    // ATTN Apply the hit deltas to the KD trees, rather than rebuilding them, so that the trees only ever contain the hits in the maps
     for (const Cluster *const pNewCluster : newClusterVector)
-        this->AddToClusterMap(pNewCluster);
+        this->AddToClusterMap(pNewCluster, true);
 
     for (unsigned int i = 0; i < newClusterVector.size(); i++)
     {
@@ -192,6 +205,7 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
     ClusterProximityMap &clusterProximityMap(
         (hitType == TPC_VIEW_U) ? m_clusterProximityMapU : (hitType == TPC_VIEW_V) ? m_clusterProximityMapV : m_clusterProximityMapW);
     ClusterToPfoMap &clusterToPfoMap((hitType == TPC_VIEW_U) ? m_clusterToPfoMapU : (hitType == TPC_VIEW_V) ? m_clusterToPfoMapV : m_clusterToPfoMapW);
+    HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
 
     CaloHitList caloHitList;
     pDeletedCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
@@ -204,6 +218,7 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
         hitToClusterMap.erase(iter);
+        kdTree.remove(HitKDNode2D(pCaloHit, pCaloHit->GetPositionVector().GetX(), pCaloHit->GetPositionVector().GetZ()));
     }
 
     const ClusterProximityMap::const_iterator clusterProximityIter(clusterProximityMap.find(pDeletedCluster));
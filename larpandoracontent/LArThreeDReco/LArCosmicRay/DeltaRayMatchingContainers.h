@@ -10,7 +10,7 @@
 
 #include "Pandora/PandoraInternal.h"
 
-#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+#include "larpandoracontent/LArUtility/KDTreeLinkerFlatAlgoT.h"
 
 namespace lar_content
 {
@@ -86,7 +86,7 @@ public:
 
 private:
     typedef std::map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
-    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeLinkerFlatAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
     typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
 
@@ -101,8 +101,9 @@ private:
      *  @brief  Add the hits of a given cluster to the hit to cluster map
      *
      *  @param  pCluster the address of the input cluster
+     *  @param  shouldUpdateKDTree whether to also insert any hits not already in the map into the (already built) KD tree
      */
-    void AddToClusterMap(const pandora::Cluster *const pCluster);
+    void AddToClusterMap(const pandora::Cluster *const pCluster, const bool shouldUpdateKDTree = false);
 
     /**
      *  @brief  Populate all cluster to pfo maps from a list of particle flow objects
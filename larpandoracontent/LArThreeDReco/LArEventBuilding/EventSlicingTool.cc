@@ -18,7 +18,7 @@
 
 #include "larpandoracontent/LArThreeDReco/LArEventBuilding/EventSlicingTool.h"
 
-#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+#include "larpandoracontent/LArUtility/KDTreeLinkerFlatAlgoT.h"
 
 using namespace pandora;
 
@@ -18,7 +18,7 @@ namespace lar_content
 {
 
 template <typename, unsigned int>
-class KDTreeLinkerAlgo;
+class KDTreeLinkerFlatAlgo;
 template <typename, unsigned int>
 class KDTreeNodeInfoT;
 
@@ -220,7 +220,7 @@ private:
     void AssignRemainingHitsToSlices(const pandora::ClusterList &remainingClusters, const ClusterToSliceIndexMap &clusterToSliceIndexMap,
         SlicingAlgorithm::SliceList &sliceList) const;
 
-    typedef KDTreeLinkerAlgo<const pandora::CartesianVector *, 2> PointKDTree2D;
+    typedef KDTreeLinkerFlatAlgo<const pandora::CartesianVector *, 2> PointKDTree2D;
     typedef KDTreeNodeInfoT<const pandora::CartesianVector *, 2> PointKDNode2D;
     typedef std::vector<PointKDNode2D> PointKDNode2DList;
 
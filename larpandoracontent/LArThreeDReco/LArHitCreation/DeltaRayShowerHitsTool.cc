@@ -20,12 +20,9 @@ using namespace pandora;
 namespace lar_content
 {
 
-void DeltaRayShowerHitsTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const ParticleFlowObject *const pPfo,
+void DeltaRayShowerHitsTool::Run(ThreeDHitCreationAlgorithm *const /*pAlgorithm*/, const ParticleFlowObject *const pPfo,
     const CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector)
 {
-    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
-        std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
-
     try
     {
         if (!LArPfoHelper::IsShower(pPfo) || (1 != pPfo->GetParentPfoList().size()))
@@ -13,6 +13,8 @@
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ShowerHitsBaseTool.h"
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeDHitCreationAlgorithm.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -27,9 +29,6 @@ ShowerHitsBaseTool::ShowerHitsBaseTool() : m_xTolerance(1.f)
 void ShowerHitsBaseTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const ParticleFlowObject *const pPfo,
     const CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector)
 {
-    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
-        std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
-
     try
     {
         if (!LArPfoHelper::IsShower(pPfo))
@@ -40,9 +39,13 @@ void ShowerHitsBaseTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const
         pAlgorithm->FilterCaloHitsByType(inputTwoDHits, TPC_VIEW_V, caloHitVectorV);
         pAlgorithm->FilterCaloHitsByType(inputTwoDHits, TPC_VIEW_W, caloHitVectorW);
 
-        this->GetShowerHits3D(caloHitVectorU, caloHitVectorV, caloHitVectorW, protoHitVector);
-        this->GetShowerHits3D(caloHitVectorV, caloHitVectorU, caloHitVectorW, protoHitVector);
-        this->GetShowerHits3D(caloHitVectorW, caloHitVectorU, caloHitVectorV, protoHitVector);
+        const SortedCaloHitIndex xSortedIndexU(caloHitVectorU, SortedCaloHitIndex::X_COORDINATE);
+        const SortedCaloHitIndex xSortedIndexV(caloHitVectorV, SortedCaloHitIndex::X_COORDINATE);
+        const SortedCaloHitIndex xSortedIndexW(caloHitVectorW, SortedCaloHitIndex::X_COORDINATE);
+
+        this->GetShowerHits3D(caloHitVectorU, xSortedIndexV, xSortedIndexW, protoHitVector);
+        this->GetShowerHits3D(caloHitVectorV, xSortedIndexU, xSortedIndexW, protoHitVector);
+        this->GetShowerHits3D(caloHitVectorW, xSortedIndexU, xSortedIndexV, protoHitVector);
     }
     catch (StatusCodeException &)
     {
@@ -51,16 +54,16 @@ void ShowerHitsBaseTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ShowerHitsBaseTool::GetShowerHits3D(const CaloHitVector &inputTwoDHits, const CaloHitVector &caloHitVector1,
-    const CaloHitVector &caloHitVector2, ProtoHitVector &protoHitVector) const
+void ShowerHitsBaseTool::GetShowerHits3D(const CaloHitVector &inputTwoDHits, const SortedCaloHitIndex &xSortedIndex1,
+    const SortedCaloHitIndex &xSortedIndex2, ProtoHitVector &protoHitVector) const
 {
     for (const CaloHit *const pCaloHit2D : inputTwoDHits)
     {
         try
         {
             CaloHitVector filteredHits1, filteredHits2;
-            this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector1, filteredHits1);
-            this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector2, filteredHits2);
+            xSortedIndex1.FindCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, false, filteredHits1);
+            xSortedIndex2.FindCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, false, filteredHits2);
 
             ProtoHit protoHit(pCaloHit2D);
             this->GetShowerHit3D(filteredHits1, filteredHits2, protoHit);
@@ -76,24 +79,65 @@ void ShowerHitsBaseTool::GetShowerHits3D(const CaloHitVector &inputTwoDHits, con
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ShowerHitsBaseTool::FilterCaloHits(const float x, const float xTolerance, const CaloHitVector &inputCaloHitVector, CaloHitVector &outputCaloHitVector) const
+StatusCode ShowerHitsBaseTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
-    for (const CaloHit *const pCaloHit : inputCaloHitVector)
-    {
-        const float deltaX(pCaloHit->GetPositionVector().GetX() - x);
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "XTolerance", m_xTolerance));
+
+    return HitCreationBaseTool::ReadSettings(xmlHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ShowerHitsBaseTool::SortedCaloHitIndex::SortedCaloHitIndex(const CaloHitVector &caloHitVector, const Coordinate coordinate) :
+    m_caloHitVector(caloHitVector)
+{
+    m_entries.reserve(caloHitVector.size());
 
-        if (std::fabs(deltaX) < xTolerance)
-            outputCaloHitVector.push_back(pCaloHit);
+    for (unsigned int index = 0; index < caloHitVector.size(); ++index)
+    {
+        const CartesianVector &position(caloHitVector.at(index)->GetPositionVector());
+        m_entries.emplace_back((X_COORDINATE == coordinate) ? position.GetX() : position.GetZ(), index);
     }
+
+    std::sort(m_entries.begin(), m_entries.end());
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode ShowerHitsBaseTool::ReadSettings(const TiXmlHandle xmlHandle)
+void ShowerHitsBaseTool::SortedCaloHitIndex::FindCaloHits(
+    const float value, const float tolerance, const bool isInclusive, CaloHitVector &outputCaloHitVector) const
 {
-    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "XTolerance", m_xTolerance));
+    std::vector<unsigned int> indices;
+    this->FindIndices(value, tolerance, isInclusive, indices);
 
-    return HitCreationBaseTool::ReadSettings(xmlHandle);
+    for (const unsigned int index : indices)
+        outputCaloHitVector.push_back(m_caloHitVector.at(index));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ShowerHitsBaseTool::SortedCaloHitIndex::FindIndices(
+    const float value, const float tolerance, const bool isInclusive, std::vector<unsigned int> &indices) const
+{
+    // ATTN The rounded difference (c - value) is monotonic in c, so these bounds select exactly the hits passing a direct comparison
+    const IndexEntryVector::const_iterator lowerIter(std::partition_point(m_entries.begin(), m_entries.end(), [&](const IndexEntry &entry) {
+        const float delta(entry.first - value);
+        return (isInclusive ? (delta < -tolerance) : (delta <= -tolerance));
+    }));
+
+    const IndexEntryVector::const_iterator upperIter(std::partition_point(lowerIter, m_entries.end(), [&](const IndexEntry &entry) {
+        const float delta(entry.first - value);
+        return (isInclusive ? (delta <= tolerance) : (delta < tolerance));
+    }));
+
+    const std::size_t firstIndex(indices.size());
+
+    for (IndexEntryVector::const_iterator iter = lowerIter; iter != upperIter; ++iter)
+        indices.push_back(iter->second);
+
+    // ATTN Restore the original ordering, so that downstream choices between equally good matches are unchanged
+    std::sort(indices.begin() + firstIndex, indices.end());
 }
 
 } // namespace lar_content
@@ -10,6 +10,9 @@
 
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/HitCreationBaseTool.h"
 
+#include <utility>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -28,6 +31,59 @@ public:
         const pandora::CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector);
 
 protected:
+    /**
+     *  @brief  SortedCaloHitIndex class, an index of calo hits sorted by a single position coordinate, for fast range queries
+     */
+    class SortedCaloHitIndex
+    {
+    public:
+        /**
+         *  @brief  Coordinate enum
+         */
+        enum Coordinate
+        {
+            X_COORDINATE,
+            Z_COORDINATE
+        };
+
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  caloHitVector the calo hit vector to index
+         *  @param  coordinate the position coordinate by which to sort the calo hits
+         */
+        SortedCaloHitIndex(const pandora::CaloHitVector &caloHitVector, const Coordinate coordinate);
+
+        /**
+         *  @brief  Find the calo hits with coordinate value, c, satisfying |c - value| < tolerance (or |c - value| <= tolerance, if
+         *          inclusive). The calo hits are returned in their order in the original calo hit vector.
+         *
+         *  @param  value the coordinate value
+         *  @param  tolerance the tolerance
+         *  @param  isInclusive whether hits lying exactly at the tolerance should be included
+         *  @param  outputCaloHitVector to receive the output calo hit vector
+         */
+        void FindCaloHits(const float value, const float tolerance, const bool isInclusive, pandora::CaloHitVector &outputCaloHitVector) const;
+
+        /**
+         *  @brief  Find the indices, in the original calo hit vector, of the calo hits with coordinate value, c, satisfying
+         *          |c - value| < tolerance (or |c - value| <= tolerance, if inclusive). The indices are returned in increasing order.
+         *
+         *  @param  value the coordinate value
+         *  @param  tolerance the tolerance
+         *  @param  isInclusive whether hits lying exactly at the tolerance should be included
+         *  @param  indices to receive the indices
+         */
+        void FindIndices(const float value, const float tolerance, const bool isInclusive, std::vector<unsigned int> &indices) const;
+
+    private:
+        typedef std::pair<float, unsigned int> IndexEntry;
+        typedef std::vector<IndexEntry> IndexEntryVector;
+
+        const pandora::CaloHitVector &m_caloHitVector; ///< The original calo hit vector
+        IndexEntryVector m_entries;                    ///< The (coordinate value, original index) pairs, sorted by coordinate value
+    };
+
     /**
      *  @brief  Get the three dimensional position for to a two dimensional calo hit, using the hit and a list of candidate matched
      *          hits in the other two views
@@ -43,27 +99,16 @@ protected:
      *          from the other two views
      *
      *  @param  inputTwoDHits the list of input two dimensional hits
-     *  @param  caloHitVector1 hits in the first alternate view
-     *  @param  caloHitVector2 hits in the second alternate view
+     *  @param  xSortedIndex1 the x-sorted index of hits in the first alternate view
+     *  @param  xSortedIndex2 the x-sorted index of hits in the second alternate view
      *  @param  protoHitVector to receive the new three dimensional proto hits
      */
-    virtual void GetShowerHits3D(const pandora::CaloHitVector &inputTwoDHits, const pandora::CaloHitVector &caloHitVector1,
-        const pandora::CaloHitVector &caloHitVector2, ProtoHitVector &protoHitVector) const;
+    virtual void GetShowerHits3D(const pandora::CaloHitVector &inputTwoDHits, const SortedCaloHitIndex &xSortedIndex1,
+        const SortedCaloHitIndex &xSortedIndex2, ProtoHitVector &protoHitVector) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private:
-    /**
-     *  @brief  Filter a list of calo hits to find those within a specified tolerance of a give x position
-     *
-     *  @param  x the x position
-     *  @param  xTolerance the x tolerance
-     *  @param  inputCaloHitVector the input calo hit vector
-     *  @param  outputCaloHitVector to receive the output calo hit vector
-     */
-    void FilterCaloHits(const float x, const float xTolerance, const pandora::CaloHitVector &inputCaloHitVector,
-        pandora::CaloHitVector &outputCaloHitVector) const;
-
     float m_xTolerance; ///< The x tolerance to use when looking for associated calo hits between views
 };
 
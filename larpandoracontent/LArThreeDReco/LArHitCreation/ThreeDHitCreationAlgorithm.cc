@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
@@ -18,6 +19,7 @@
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeDHitCreationAlgorithm.h"
 
 #include <algorithm>
+#include <exception>
 
 using namespace pandora;
 
@@ -30,7 +32,8 @@ ThreeDHitCreationAlgorithm::ThreeDHitCreationAlgorithm() :
     m_slidingFitHalfWindow(10),
     m_nHitRefinementIterations(10),
     m_sigma3DFitMultiplier(0.2),
-    m_iterationMaxChi2Ratio(1.)
+    m_iterationMaxChi2Ratio(1.),
+    m_nThreads(1)
 {
 }
 
@@ -66,32 +69,72 @@ StatusCode ThreeDHitCreationAlgorithm::Run()
     PfoVector pfoVector(pPfoList->begin(), pPfoList->end());
     std::sort(pfoVector.begin(), pfoVector.end(), LArPfoHelper::SortByNHits);
 
-    for (const ParticleFlowObject *const pPfo : pfoVector)
+    const unsigned int nPfos(pfoVector.size());
+    unsigned int batchBegin(0);
+
+    while (batchBegin < nPfos)
     {
-        ProtoHitVector protoHitVector;
+        // ATTN Hit creation may use the 3D hits of a parent pfo, so a batch ends before any pfo whose parent is yet to receive its 3D hits
+        PfoSet batchPfos;
+        unsigned int batchEnd(batchBegin);
 
-        for (HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
+        for (; batchEnd < nPfos; ++batchEnd)
         {
-            CaloHitVector remainingTwoDHits;
-            this->SeparateTwoDHits(pPfo, protoHitVector, remainingTwoDHits);
+            const ParticleFlowObject *const pPfo(pfoVector.at(batchEnd));
+            const PfoList &parentPfoList(pPfo->GetParentPfoList());
 
-            if (remainingTwoDHits.empty())
+            if (std::any_of(parentPfoList.begin(), parentPfoList.end(),
+                    [&](const ParticleFlowObject *const pParentPfo) { return (batchPfos.count(pParentPfo) > 0); }))
                 break;
 
-            pHitCreationTool->Run(this, pPfo, remainingTwoDHits, protoHitVector);
+            batchPfos.insert(pPfo);
         }
 
-        if ((m_iterateTrackHits && LArPfoHelper::IsTrack(pPfo)) || (m_iterateShowerHits && LArPfoHelper::IsShower(pPfo)))
-            this->IterativeTreatment(protoHitVector);
+        const unsigned int nBatchPfos(batchEnd - batchBegin);
+        std::vector<ProtoHitVector> protoHitVectors(nBatchPfos);
+        std::vector<HitCreationToolVector> toolsRunVectors(nBatchPfos);
+        std::vector<std::exception_ptr> pfoExceptions(nBatchPfos, nullptr);
+
+        // ATTN Proto hits for the batch are calculated first, possibly concurrently, then the pandora objects are created serially, in pfo order
+        LArThreadingHelper::ParallelFor(nBatchPfos, m_nThreads, [&](const unsigned int iBatchPfo) {
+            try
+            {
+                this->CreateProtoHits(pfoVector.at(batchBegin + iBatchPfo), protoHitVectors.at(iBatchPfo), toolsRunVectors.at(iBatchPfo));
+            }
+            catch (...)
+            {
+                pfoExceptions.at(iBatchPfo) = std::current_exception();
+            }
+        });
+
+        for (unsigned int iBatchPfo = 0; iBatchPfo < nBatchPfos; ++iBatchPfo)
+        {
+            if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+            {
+                for (const HitCreationBaseTool *const pHitCreationTool : toolsRunVectors.at(iBatchPfo))
+                {
+                    std::cout << "----> Running Algorithm Tool: " << pHitCreationTool->GetInstanceName() << ", " << pHitCreationTool->GetType()
+                              << std::endl;
+                }
+            }
 
-        if (protoHitVector.empty())
-            continue;
+            // ATTN Rethrow at the point at which serial processing would have thrown, once objects for all preceding pfos have been created
+            if (pfoExceptions.at(iBatchPfo))
+                std::rethrow_exception(pfoExceptions.at(iBatchPfo));
+
+            const ProtoHitVector &protoHitVector(protoHitVectors.at(iBatchPfo));
+
+            if (protoHitVector.empty())
+                continue;
+
+            CaloHitList newThreeDHits;
+            this->CreateThreeDHits(protoHitVector, newThreeDHits);
+            this->AddThreeDHitsToPfo(pfoVector.at(batchBegin + iBatchPfo), newThreeDHits);
 
-        CaloHitList newThreeDHits;
-        this->CreateThreeDHits(protoHitVector, newThreeDHits);
-        this->AddThreeDHitsToPfo(pPfo, newThreeDHits);
+            allNewThreeDHits.insert(allNewThreeDHits.end(), newThreeDHits.begin(), newThreeDHits.end());
+        }
 
-        allNewThreeDHits.insert(allNewThreeDHits.end(), newThreeDHits.begin(), newThreeDHits.end());
+        batchBegin = batchEnd;
     }
 
     if (!allNewThreeDHits.empty())
@@ -102,6 +145,26 @@ StatusCode ThreeDHitCreationAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeDHitCreationAlgorithm::CreateProtoHits(const ParticleFlowObject *const pPfo, ProtoHitVector &protoHitVector, HitCreationToolVector &toolsRun)
+{
+    for (HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
+    {
+        CaloHitVector remainingTwoDHits;
+        this->SeparateTwoDHits(pPfo, protoHitVector, remainingTwoDHits);
+
+        if (remainingTwoDHits.empty())
+            break;
+
+        toolsRun.push_back(pHitCreationTool);
+        pHitCreationTool->Run(this, pPfo, remainingTwoDHits, protoHitVector);
+    }
+
+    if ((m_iterateTrackHits && LArPfoHelper::IsTrack(pPfo)) || (m_iterateShowerHits && LArPfoHelper::IsShower(pPfo)))
+        this->IterativeTreatment(protoHitVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeDHitCreationAlgorithm::SeparateTwoDHits(
     const ParticleFlowObject *const pPfo, const ProtoHitVector &protoHitVector, CaloHitVector &remainingHitVector) const
 {
@@ -255,6 +318,10 @@ void ThreeDHitCreationAlgorithm::RefineHitPositions(const ThreeDSlidingFitResult
     const double sigmaHit(sigmaUVW);
     const double sigma3DFit(sigmaUVW * m_sigma3DFitMultiplier);
 
+    // ATTN Gather the inputs for all proto hits, so that the minimum chi-squared positions can be calculated in a single batch
+    std::vector<ProtoHit *> refinedProtoHits;
+    LArGeometryHelper::DoubleVector uValues, vValues, wValues, sigmaUValues, sigmaVValues, sigmaWValues, uFitValues, vFitValues, wFitValues;
+
     for (ProtoHit &protoHit : protoHitVector)
     {
         CartesianVector pointOnFit(0.f, 0.f, 0.f);
@@ -274,8 +341,6 @@ void ThreeDHitCreationAlgorithm::RefineHitPositions(const ThreeDSlidingFitResult
         const double sigmaV((TPC_VIEW_V == hitType) ? sigmaHit : sigmaFit);
         const double sigmaW((TPC_VIEW_W == hitType) ? sigmaHit : sigmaFit);
 
-        CartesianVector position3D(0.f, 0.f, 0.f);
-        double chi2(std::numeric_limits<double>::max());
         double u(std::numeric_limits<double>::max()), v(std::numeric_limits<double>::max()), w(std::numeric_limits<double>::max());
 
         if (protoHit.GetNTrajectorySamples() == 2)
@@ -308,12 +373,29 @@ void ThreeDHitCreationAlgorithm::RefineHitPositions(const ThreeDSlidingFitResult
             throw StatusCodeException(STATUS_CODE_FAILURE);
         }
 
-        double bestY(std::numeric_limits<double>::max()), bestZ(std::numeric_limits<double>::max());
-        PandoraContentApi::GetPlugins(*this)->GetLArTransformationPlugin()->GetMinChiSquaredYZ(
-            u, v, w, sigmaU, sigmaV, sigmaW, uFit, vFit, wFit, sigma3DFit, bestY, bestZ, chi2);
-        position3D.SetValues(pCaloHit2D->GetPositionVector().GetX(), static_cast<float>(bestY), static_cast<float>(bestZ));
+        refinedProtoHits.push_back(&protoHit);
+        uValues.push_back(u);
+        vValues.push_back(v);
+        wValues.push_back(w);
+        sigmaUValues.push_back(sigmaU);
+        sigmaVValues.push_back(sigmaV);
+        sigmaWValues.push_back(sigmaW);
+        uFitValues.push_back(uFit);
+        vFitValues.push_back(vFit);
+        wFitValues.push_back(wFit);
+    }
+
+    LArGeometryHelper::DoubleVector bestYValues, bestZValues, chi2Values;
+    LArGeometryHelper::GetMinChiSquaredYZ(this->GetPandora(), uValues, vValues, wValues, sigmaUValues, sigmaVValues, sigmaWValues, uFitValues,
+        vFitValues, wFitValues, sigma3DFit, bestYValues, bestZValues, chi2Values);
 
-        protoHit.SetPosition3D(position3D, chi2);
+    for (unsigned int iHit = 0; iHit < refinedProtoHits.size(); ++iHit)
+    {
+        ProtoHit *const pProtoHit(refinedProtoHits.at(iHit));
+        const CartesianVector position3D(pProtoHit->GetParentCaloHit2D()->GetPositionVector().GetX(), static_cast<float>(bestYValues.at(iHit)),
+            static_cast<float>(bestZValues.at(iHit)));
+
+        pProtoHit->SetPosition3D(position3D, chi2Values.at(iHit));
     }
 }
 
@@ -497,6 +579,9 @@ StatusCode ThreeDHitCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "IterationMaxChi2Ratio", m_iterationMaxChi2Ratio));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NThreads", m_nThreads));
+    m_nThreads = LArThreadingHelper::GetNThreads(m_nThreads);
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -178,8 +178,22 @@ public:
         const pandora::CaloHitVector &inputCaloHitVector, const pandora::HitType hitType, pandora::CaloHitVector &outputCaloHitVector) const;
 
 private:
+    typedef std::vector<HitCreationBaseTool *> HitCreationToolVector;
+
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Calculate the proto hits for a pfo, running the hit creation tools and, if requested, the iterative treatment. This may be
+     *          called for different pfos concurrently, as it only reads the pfo, its clusters and calo hits, the 3D hits of its parent
+     *          pfo (created in an earlier batch), the geometry and plugins, and the settings of this algorithm and its tools, none of
+     *          which change until all calls have returned. Nothing is printed; the tools run are recorded for serial reporting.
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  protoHitVector to receive the proto hits
+     *  @param  toolsRun to receive the hit creation tools run, in order
+     */
+    void CreateProtoHits(const pandora::ParticleFlowObject *const pPfo, ProtoHitVector &protoHitVector, HitCreationToolVector &toolsRun);
+
     /**
      *  @brief  Get the list of 2D calo hits in a pfo for which 3D hits have and have not been created
      *
@@ -268,7 +282,6 @@ private:
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    typedef std::vector<HitCreationBaseTool *> HitCreationToolVector;
     HitCreationToolVector m_algorithmToolVector; ///< The algorithm tool vector
 
     std::string m_inputPfoListName;      ///< The name of the input pfo list
@@ -281,6 +294,7 @@ private:
     unsigned int m_nHitRefinementIterations; ///< The maximum number of hit refinement iterations
     double m_sigma3DFitMultiplier;           ///< Multiplicative factor: sigmaUVW (same as sigmaHit and sigma2DFit) to sigma3DFit
     double m_iterationMaxChi2Ratio;          ///< Max ratio between current and previous chi2 values to cease iterations
+    unsigned int m_nThreads;                 ///< The number of threads across which to calculate the proto hits (0 for hardware concurrency)
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -35,17 +35,20 @@ void ThreeViewShowerHitsTool::GetShowerHit3D(const CaloHitVector &caloHitVector1
     const HitType hitType2D(pCaloHit2D->GetHitType());
     const float position2D(pCaloHit2D->GetPositionVector().GetZ());
 
+    const SortedCaloHitIndex zSortedIndex2(caloHitVector2, SortedCaloHitIndex::Z_COORDINATE);
+    std::vector<unsigned int> indices2;
+
     for (const CaloHit *const pCaloHit1 : caloHitVector1)
     {
         const CartesianVector &position1(pCaloHit1->GetPositionVector());
         const float prediction(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), hitType2D, hitType1, position2D, position1.GetZ()));
 
-        for (const CaloHit *const pCaloHit2 : caloHitVector2)
-        {
-            const CartesianVector &position2(pCaloHit2->GetPositionVector());
+        indices2.clear();
+        zSortedIndex2.FindIndices(prediction, m_zTolerance, true, indices2);
 
-            if (std::fabs(position2.GetZ() - prediction) > m_zTolerance)
-                continue;
+        for (const unsigned int index2 : indices2)
+        {
+            const CartesianVector &position2(caloHitVector2.at(index2)->GetPositionVector());
 
             ProtoHit thisProtoHit(pCaloHit2D);
             this->GetBestPosition3D(hitType1, hitType2, position1, position2, thisProtoHit);
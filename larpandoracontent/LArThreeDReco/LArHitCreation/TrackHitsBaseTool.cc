@@ -26,12 +26,9 @@ TrackHitsBaseTool::TrackHitsBaseTool() : m_minViews(2), m_slidingFitWindow(20)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackHitsBaseTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const ParticleFlowObject *const pPfo,
+void TrackHitsBaseTool::Run(ThreeDHitCreationAlgorithm *const /*pAlgorithm*/, const ParticleFlowObject *const pPfo,
     const CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector)
 {
-    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
-        std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
-
     try
     {
         if (!LArPfoHelper::IsTrack(pPfo))
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArShowerMatching/ThreeViewShowersAlgorithm.h"
 
@@ -26,7 +27,8 @@ ThreeViewShowersAlgorithm::ThreeViewShowersAlgorithm() :
     m_minClusterLengthSquared(3.f * 3.f),
     m_minShowerMatchedFraction(0.2f),
     m_minShowerMatchedPoints(20),
-    m_visualize(false)
+    m_visualize(false),
+    m_nThreads(1)
 {
 }
 
@@ -166,8 +168,28 @@ void ThreeViewShowersAlgorithm::CalculateOverlapResult(const Cluster *const pClu
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeViewShowersAlgorithm::CalculateOverlapResults(
+    const ClusterVector &clusterVectorU, const ClusterVector &clusterVectorV, const ClusterVector &clusterVectorW)
+{
+    // ATTN Visualization requires serial processing
+    if ((m_nThreads < 2) || m_visualize)
+        return BaseAlgorithm::CalculateOverlapResults(clusterVectorU, clusterVectorV, clusterVectorW);
+
+    // ATTN No overlap result is possible unless the shower fit x spans of all three clusters overlap
+    this->GetMatchingControl().CalculateOverlapResults(clusterVectorU, clusterVectorV, clusterVectorW, m_nThreads,
+        std::numeric_limits<float>::epsilon(),
+        [this](const Cluster *const pCluster, float &minX, float &maxX) {
+            this->GetCachedSlidingFitResult(pCluster).GetShowerFitResult().GetMinAndMaxX(minX, maxX);
+        },
+        [this](const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW, ShowerOverlapResult &overlapResult) {
+            return this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+        });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeViewShowersAlgorithm::CalculateOverlapResult(
-    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW, ShowerOverlapResult &overlapResult)
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW, ShowerOverlapResult &overlapResult) const
 {
     const TwoDSlidingShowerFitResult &fitResultU(this->GetCachedSlidingFitResult(pClusterU));
     const TwoDSlidingShowerFitResult &fitResultV(this->GetCachedSlidingFitResult(pClusterV));
@@ -419,6 +441,9 @@ StatusCode ThreeViewShowersAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Visualize", m_visualize));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NThreads", m_nThreads));
+    m_nThreads = LArThreadingHelper::GetNThreads(m_nThreads);
+
     return BaseAlgorithm::ReadSettings(xmlHandle);
 }
 
@@ -103,9 +103,12 @@ private:
     void RemoveFromSlidingFitCache(const pandora::Cluster *const pCluster);
 
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    void CalculateOverlapResults(
+        const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV, const pandora::ClusterVector &clusterVectorW);
 
     /**
-     *  @brief  Calculate the overlap result for given group of clusters
+     *  @brief  Calculate the overlap result for given group of clusters. Reads only the cached sliding shower fits, the clusters and
+     *          their hits, the geometry and the settings. The visualization step is the exception, so visualization forces serial processing
      *
      *  @param  pClusterU the cluster from the U view
      *  @param  pClusterV the cluster from the V view
@@ -113,7 +116,7 @@ private:
      *  @param  overlapResult to receive the overlap result
      */
     pandora::StatusCode CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
-        const pandora::Cluster *const pClusterW, ShowerOverlapResult &overlapResult);
+        const pandora::Cluster *const pClusterW, ShowerOverlapResult &overlapResult) const;
 
     typedef std::pair<ShowerPositionMap, ShowerPositionMap> ShowerPositionMapPair;
 
@@ -161,6 +164,7 @@ private:
     float m_minShowerMatchedFraction;      ///< The minimum shower matched sampling fraction to allow shower grouping
     unsigned int m_minShowerMatchedPoints; ///< The minimum number of matched shower sampling points to allow shower grouping
     bool m_visualize;                      ///< Visualize cluster matching procedure
+    unsigned int m_nThreads;               ///< The number of threads across which to calculate overlap results (0 for hardware concurrency)
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -29,6 +29,21 @@ MatchingBaseAlgorithm::~MatchingBaseAlgorithm()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void MatchingBaseAlgorithm::CalculateOverlapResults(
+    const ClusterVector &clusterVector1, const ClusterVector &clusterVector2, const ClusterVector &clusterVector3)
+{
+    for (const Cluster *const pCluster1 : clusterVector1)
+    {
+        for (const Cluster *const pCluster2 : clusterVector2)
+        {
+            for (const Cluster *const pCluster3 : clusterVector3)
+                this->CalculateOverlapResult(pCluster1, pCluster2, pCluster3);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void MatchingBaseAlgorithm::SelectInputClusters(const ClusterList *const pInputClusterList, ClusterList &selectedClusterList) const
 {
     if (!pInputClusterList)
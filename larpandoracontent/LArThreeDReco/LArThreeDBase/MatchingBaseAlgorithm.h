@@ -99,6 +99,17 @@ public:
     virtual void CalculateOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
         const pandora::Cluster *const pCluster3 = nullptr) = 0;
 
+    /**
+     *  @brief  Calculate cluster overlap results for all combinations of clusters from three views and store in container. The default
+     *          implementation calls CalculateOverlapResult for each combination in turn, varying the view 3 cluster fastest.
+     *
+     *  @param  clusterVector1 the view 1 clusters
+     *  @param  clusterVector2 the view 2 clusters
+     *  @param  clusterVector3 the view 3 clusters
+     */
+    virtual void CalculateOverlapResults(
+        const pandora::ClusterVector &clusterVector1, const pandora::ClusterVector &clusterVector2, const pandora::ClusterVector &clusterVector3);
+
     /**
      *  @brief  Select a subset of input clusters for processing in this algorithm
      *
@@ -70,23 +70,19 @@ void ThreeViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewC
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVector3.begin(), clusterVector3.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pCluster2 : clusterVector2)
+    const ClusterVector newClusterVector(1, pNewCluster);
+
+    if (TPC_VIEW_U == hitType)
+    {
+        m_pAlgorithm->CalculateOverlapResults(newClusterVector, clusterVector2, clusterVector3);
+    }
+    else if (TPC_VIEW_V == hitType)
     {
-        for (const Cluster *const pCluster3 : clusterVector3)
-        {
-            if (TPC_VIEW_U == hitType)
-            {
-                m_pAlgorithm->CalculateOverlapResult(pNewCluster, pCluster2, pCluster3);
-            }
-            else if (TPC_VIEW_V == hitType)
-            {
-                m_pAlgorithm->CalculateOverlapResult(pCluster2, pNewCluster, pCluster3);
-            }
-            else
-            {
-                m_pAlgorithm->CalculateOverlapResult(pCluster2, pCluster3, pNewCluster);
-            }
-        }
+        m_pAlgorithm->CalculateOverlapResults(clusterVector2, newClusterVector, clusterVector3);
+    }
+    else
+    {
+        m_pAlgorithm->CalculateOverlapResults(clusterVector2, clusterVector3, newClusterVector);
     }
 }
 
@@ -225,14 +221,7 @@ void ThreeViewMatchingControl<T>::PerformMainLoop()
     std::sort(clusterVectorV.begin(), clusterVectorV.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVectorW.begin(), clusterVectorW.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pClusterU : clusterVectorU)
-    {
-        for (const Cluster *const pClusterV : clusterVectorV)
-        {
-            for (const Cluster *const pClusterW : clusterVectorW)
-                m_pAlgorithm->CalculateOverlapResult(pClusterU, pClusterV, pClusterW);
-        }
-    }
+    m_pAlgorithm->CalculateOverlapResults(clusterVectorU, clusterVectorV, clusterVectorW);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -8,10 +8,15 @@
 #ifndef LAR_THREE_VIEW_MATCHING_CONTROL_H
 #define LAR_THREE_VIEW_MATCHING_CONTROL_H 1
 
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
+
 #include "larpandoracontent/LArObjects/LArOverlapTensor.h"
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingControl.h"
 
+#include <array>
+#include <utility>
+
 namespace lar_content
 {
 
@@ -43,6 +48,29 @@ public:
      */
     TensorType &GetOverlapTensor();
 
+    /**
+     *  @brief  Calculate overlap results for all combinations of u, v and w clusters, distributing the calculations over a number of
+     *          threads, then store the results in the overlap tensor serially, in the order of a nested loop over the u, v and w clusters.
+     *          Combinations for which the cluster x spans cannot overlap by the minimum amount are never scheduled. The x spans are all
+     *          found serially, before any overlap result is calculated. As the overlap results may be calculated concurrently, the calculator
+     *          must only read the clusters and their hits, per-cluster state (e.g. sliding fits) filled before this call, the input cluster
+     *          lists, the geometry and plugins, and the algorithm settings. It must not modify the overlap tensor, create or modify pandora
+     *          objects, or produce visualization or screen output.
+     *
+     *  @param  clusterVectorU the u clusters
+     *  @param  clusterVectorV the v clusters
+     *  @param  clusterVectorW the w clusters
+     *  @param  nThreads the maximum number of threads to use
+     *  @param  minXOverlap the x overlap below which no overlap result can be found
+     *  @param  getXSpan callable receiving a cluster and references to its minimum and maximum x coordinates
+     *  @param  calculateOverlapResult callable receiving a u, v and w cluster and a reference to the overlap result, and returning
+     *          STATUS_CODE_SUCCESS or STATUS_CODE_NOT_FOUND
+     */
+    template <typename XSPAN, typename CALCULATOR>
+    void CalculateOverlapResults(const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV,
+        const pandora::ClusterVector &clusterVectorW, const unsigned int nThreads, const float minXOverlap, const XSPAN &getXSpan,
+        const CALCULATOR &calculateOverlapResult);
+
 private:
     void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
     void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
@@ -76,6 +104,70 @@ private:
     friend class NViewMatchingAlgorithm;
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+template <typename XSPAN, typename CALCULATOR>
+void ThreeViewMatchingControl<T>::CalculateOverlapResults(const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV,
+    const pandora::ClusterVector &clusterVectorW, const unsigned int nThreads, const float minXOverlap, const XSPAN &getXSpan,
+    const CALCULATOR &calculateOverlapResult)
+{
+    pandora::FloatVector minXU(clusterVectorU.size()), maxXU(clusterVectorU.size());
+    pandora::FloatVector minXV(clusterVectorV.size()), maxXV(clusterVectorV.size());
+    pandora::FloatVector minXW(clusterVectorW.size()), maxXW(clusterVectorW.size());
+
+    for (unsigned int iU = 0; iU < clusterVectorU.size(); ++iU)
+        getXSpan(clusterVectorU.at(iU), minXU.at(iU), maxXU.at(iU));
+
+    for (unsigned int iV = 0; iV < clusterVectorV.size(); ++iV)
+        getXSpan(clusterVectorV.at(iV), minXV.at(iV), maxXV.at(iV));
+
+    for (unsigned int iW = 0; iW < clusterVectorW.size(); ++iW)
+        getXSpan(clusterVectorW.at(iW), minXW.at(iW), maxXW.at(iW));
+
+    typedef std::array<const pandora::Cluster *, 3> ClusterCombination;
+    std::vector<ClusterCombination> clusterCombinations;
+
+    for (unsigned int iU = 0; iU < clusterVectorU.size(); ++iU)
+    {
+        for (unsigned int iV = 0; iV < clusterVectorV.size(); ++iV)
+        {
+            const float minXUV(std::max(minXU.at(iU), minXV.at(iV))), maxXUV(std::min(maxXU.at(iU), maxXV.at(iV)));
+
+            if ((maxXUV - minXUV) < minXOverlap)
+                continue;
+
+            for (unsigned int iW = 0; iW < clusterVectorW.size(); ++iW)
+            {
+                if ((std::min(maxXUV, maxXW.at(iW)) - std::max(minXUV, minXW.at(iW))) < minXOverlap)
+                    continue;
+
+                clusterCombinations.push_back({clusterVectorU.at(iU), clusterVectorV.at(iV), clusterVectorW.at(iW)});
+            }
+        }
+    }
+
+    typedef std::pair<pandora::StatusCode, T> CombinationResult;
+
+    // ATTN Overlap results are calculated first, possibly concurrently, then stored serially, in combination order
+    LArThreadingHelper::ParallelCalculateThenStore<CombinationResult>(clusterCombinations.size(), nThreads,
+        [&](const unsigned int iCombination, CombinationResult &combinationResult) {
+            const ClusterCombination &clusterCombination(clusterCombinations.at(iCombination));
+            combinationResult.first =
+                calculateOverlapResult(clusterCombination.at(0), clusterCombination.at(1), clusterCombination.at(2), combinationResult.second);
+        },
+        [&](const unsigned int iCombination, const CombinationResult &combinationResult) {
+            if ((pandora::STATUS_CODE_SUCCESS != combinationResult.first) && (pandora::STATUS_CODE_NOT_FOUND != combinationResult.first))
+                throw pandora::StatusCodeException(combinationResult.first);
+
+            if (combinationResult.second.IsInitialized())
+            {
+                const ClusterCombination &clusterCombination(clusterCombinations.at(iCombination));
+                m_overlapTensor.SetOverlapResult(clusterCombination.at(0), clusterCombination.at(1), clusterCombination.at(2), combinationResult.second);
+            }
+        });
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_THREE_VIEW_MATCHING_CONTROL_H
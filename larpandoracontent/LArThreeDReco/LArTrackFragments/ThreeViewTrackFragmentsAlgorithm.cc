@@ -10,9 +10,12 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArTrackFragments/ThreeViewTrackFragmentsAlgorithm.h"
 
+#include <tuple>
+
 using namespace pandora;
 
 namespace lar_content
@@ -24,7 +27,8 @@ ThreeViewTrackFragmentsAlgorithm::ThreeViewTrackFragmentsAlgorithm() :
     m_minXOverlapFraction(0.8f),
     m_maxPointDisplacementSquared(1.5f * 1.5f),
     m_minMatchedSamplingPointFraction(0.5f),
-    m_minMatchedHits(5)
+    m_minMatchedHits(5),
+    m_nThreads(1)
 {
 }
 
@@ -64,19 +68,21 @@ void ThreeViewTrackFragmentsAlgorithm::UpdateForNewCluster(const Cluster *const
     clusterList1.sort(LArClusterHelper::SortByNHits);
     clusterList2.sort(LArClusterHelper::SortByNHits);
 
+    ClusterTripletVector clusterTriplets;
+
     for (const Cluster *const pCluster1 : clusterList1)
     {
         if (TPC_VIEW_U == hitType)
         {
-            this->CalculateOverlapResult(pNewCluster, pCluster1, nullptr);
+            clusterTriplets.push_back({pNewCluster, pCluster1, nullptr});
         }
         else if (TPC_VIEW_V == hitType)
         {
-            this->CalculateOverlapResult(pCluster1, pNewCluster, nullptr);
+            clusterTriplets.push_back({pCluster1, pNewCluster, nullptr});
         }
         else
         {
-            this->CalculateOverlapResult(pCluster1, nullptr, pNewCluster);
+            clusterTriplets.push_back({pCluster1, nullptr, pNewCluster});
         }
     }
 
@@ -84,17 +90,19 @@ void ThreeViewTrackFragmentsAlgorithm::UpdateForNewCluster(const Cluster *const
     {
         if (TPC_VIEW_U == hitType)
         {
-            this->CalculateOverlapResult(pNewCluster, nullptr, pCluster2);
+            clusterTriplets.push_back({pNewCluster, nullptr, pCluster2});
         }
         else if (TPC_VIEW_V == hitType)
         {
-            this->CalculateOverlapResult(nullptr, pNewCluster, pCluster2);
+            clusterTriplets.push_back({nullptr, pNewCluster, pCluster2});
         }
         else
         {
-            this->CalculateOverlapResult(nullptr, pCluster2, pNewCluster);
+            clusterTriplets.push_back({nullptr, pCluster2, pNewCluster});
         }
     }
+
+    this->CalculateOverlapResults(clusterTriplets);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -123,28 +131,108 @@ void ThreeViewTrackFragmentsAlgorithm::PerformMainLoop()
     clusterListV.sort(LArClusterHelper::SortByNHits);
     clusterListW.sort(LArClusterHelper::SortByNHits);
 
+    ClusterTripletVector clusterTriplets;
+
     for (const Cluster *const pClusterU : clusterListU)
     {
         for (const Cluster *const pClusterV : clusterListV)
-            this->CalculateOverlapResult(pClusterU, pClusterV, nullptr);
+            clusterTriplets.push_back({pClusterU, pClusterV, nullptr});
     }
 
     for (const Cluster *const pClusterU : clusterListU)
     {
         for (const Cluster *const pClusterW : clusterListW)
-            this->CalculateOverlapResult(pClusterU, nullptr, pClusterW);
+            clusterTriplets.push_back({pClusterU, nullptr, pClusterW});
     }
 
     for (const Cluster *const pClusterV : clusterListV)
     {
         for (const Cluster *const pClusterW : clusterListW)
-            this->CalculateOverlapResult(nullptr, pClusterV, pClusterW);
+            clusterTriplets.push_back({nullptr, pClusterV, pClusterW});
     }
+
+    this->CalculateOverlapResults(clusterTriplets);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ThreeViewTrackFragmentsAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
+{
+    const Cluster *pBestMatchedCluster(nullptr);
+    FragmentOverlapResult newOverlapResult;
+    const StatusCode statusCode(this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, pBestMatchedCluster, newOverlapResult));
+
+    this->StoreOverlapResult(pClusterU, pClusterV, pClusterW, statusCode, pBestMatchedCluster, newOverlapResult);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreeViewTrackFragmentsAlgorithm::CalculateOverlapResults(const ClusterTripletVector &clusterTriplets)
+{
+    if (m_nThreads < 2)
+    {
+        for (const ClusterTriplet &clusterTriplet : clusterTriplets)
+            this->CalculateOverlapResult(clusterTriplet.at(0), clusterTriplet.at(1), clusterTriplet.at(2));
+
+        return;
+    }
+
+    // ATTN Candidates whose two cluster x spans cannot overlap by the minimum amount can never yield an overlap result, so are not scheduled
+    const float minXOverlap(std::max(std::numeric_limits<float>::epsilon(), m_minXOverlap));
+    std::unordered_map<const Cluster *, std::pair<float, float>> clusterToSpanXMap;
+    ClusterTripletVector candidateTriplets;
+
+    for (const ClusterTriplet &clusterTriplet : clusterTriplets)
+    {
+        unsigned int nClusters(0);
+        float minX(-std::numeric_limits<float>::max()), maxX(std::numeric_limits<float>::max());
+
+        for (const Cluster *const pCluster : clusterTriplet)
+        {
+            if (nullptr == pCluster)
+                continue;
+
+            auto iter(clusterToSpanXMap.find(pCluster));
+
+            if (clusterToSpanXMap.end() == iter)
+            {
+                float xMin(0.f), xMax(0.f);
+                pCluster->GetClusterSpanX(xMin, xMax);
+                iter = clusterToSpanXMap.emplace(pCluster, std::make_pair(xMin, xMax)).first;
+            }
+
+            minX = std::max(minX, iter->second.first);
+            maxX = std::min(maxX, iter->second.second);
+            ++nClusters;
+        }
+
+        // ATTN Malformed candidates are retained, so that they raise the usual exception at the usual point
+        if ((2 == nClusters) && ((maxX - minX) < minXOverlap))
+            continue;
+
+        candidateTriplets.push_back(clusterTriplet);
+    }
+
+    typedef std::tuple<StatusCode, const Cluster *, FragmentOverlapResult> CandidateResult;
+
+    // ATTN Later candidates may replace results stored for earlier candidates, so results must be stored serially, in candidate order
+    LArThreadingHelper::ParallelCalculateThenStore<CandidateResult>(candidateTriplets.size(), m_nThreads,
+        [&](const unsigned int iCandidate, CandidateResult &candidateResult) {
+            const ClusterTriplet &clusterTriplet(candidateTriplets.at(iCandidate));
+            std::get<0>(candidateResult) = this->CalculateOverlapResult(clusterTriplet.at(0), clusterTriplet.at(1), clusterTriplet.at(2),
+                std::get<1>(candidateResult), std::get<2>(candidateResult));
+        },
+        [&](const unsigned int iCandidate, const CandidateResult &candidateResult) {
+            const ClusterTriplet &clusterTriplet(candidateTriplets.at(iCandidate));
+            this->StoreOverlapResult(clusterTriplet.at(0), clusterTriplet.at(1), clusterTriplet.at(2), std::get<0>(candidateResult),
+                std::get<1>(candidateResult), std::get<2>(candidateResult));
+        });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ThreeViewTrackFragmentsAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV,
+    const Cluster *const pClusterW, const Cluster *&pBestMatchedCluster, FragmentOverlapResult &fragmentOverlapResult) const
 {
     const HitType missingHitType(((nullptr != pClusterU) && (nullptr != pClusterV) && (nullptr == pClusterW))
                                      ? TPC_VIEW_W
@@ -155,10 +243,6 @@ void ThreeViewTrackFragmentsAlgorithm::CalculateOverlapResult(const Cluster *con
     if (HIT_CUSTOM == missingHitType)
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    // Calculate new overlap result and replace old overlap result where necessary
-    FragmentOverlapResult oldOverlapResult, newOverlapResult;
-    const Cluster *pMatchedClusterU(nullptr), *pMatchedClusterV(nullptr), *pMatchedClusterW(nullptr);
-
     const TwoDSlidingFitResult &fitResult1(
         (TPC_VIEW_U == missingHitType) ? this->GetCachedSlidingFitResult(pClusterV) : this->GetCachedSlidingFitResult(pClusterU));
 
@@ -169,15 +253,23 @@ void ThreeViewTrackFragmentsAlgorithm::CalculateOverlapResult(const Cluster *con
 
     const ClusterList &inputClusterList(this->GetInputClusterList(missingHitType));
 
-    const Cluster *pBestMatchedCluster(nullptr);
-    const StatusCode statusCode(this->CalculateOverlapResult(fitResult1, fitResult2, inputClusterList, pBestMatchedCluster, newOverlapResult));
+    return this->CalculateOverlapResult(fitResult1, fitResult2, inputClusterList, pBestMatchedCluster, fragmentOverlapResult);
+}
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreeViewTrackFragmentsAlgorithm::StoreOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV,
+    const Cluster *const pClusterW, const StatusCode statusCode, const Cluster *const pBestMatchedCluster, const FragmentOverlapResult &newOverlapResult)
+{
     if ((STATUS_CODE_SUCCESS != statusCode) && (STATUS_CODE_NOT_FOUND != statusCode))
         throw StatusCodeException(statusCode);
 
     if (!newOverlapResult.IsInitialized())
         return;
 
+    // Replace old overlap result where necessary
+    FragmentOverlapResult oldOverlapResult;
+    const Cluster *pMatchedClusterU(nullptr), *pMatchedClusterV(nullptr), *pMatchedClusterW(nullptr);
     MatchingType::TensorType &overlapTensor(this->GetMatchingControl().GetOverlapTensor());
 
     if (STATUS_CODE_SUCCESS == statusCode)
@@ -677,6 +769,9 @@ StatusCode ThreeViewTrackFragmentsAlgorithm::ReadSettings(const TiXmlHandle xmlH
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinMatchedHits", m_minMatchedHits));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NThreads", m_nThreads));
+    m_nThreads = LArThreadingHelper::GetNThreads(m_nThreads);
+
     return BaseAlgorithm::ReadSettings(xmlHandle);
 }
 
@@ -16,6 +16,7 @@
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewTrackMatchingAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeViewMatchingControl.h"
 
+#include <array>
 #include <unordered_map>
 
 namespace lar_content
@@ -52,6 +53,46 @@ protected:
     void PerformMainLoop();
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
 
+    typedef std::array<const pandora::Cluster *, 3> ClusterTriplet;
+    typedef std::vector<ClusterTriplet> ClusterTripletVector;
+
+    /**
+     *  @brief  Calculate and store overlap results for a list of track fragment candidates, each consisting of two clusters and a missing
+     *          view. Calculations may be distributed over a number of threads, but results are always stored in candidate order. The
+     *          calculations only read the sliding fit result map, filled before the main loop, the input cluster lists and their clusters
+     *          and hits, the geometry and plugins, and the algorithm settings.
+     *
+     *  @param  clusterTriplets the candidate u, v and w clusters, with a nullptr for the missing view
+     */
+    void CalculateOverlapResults(const ClusterTripletVector &clusterTriplets);
+
+    /**
+     *  @brief  Calculate overlap result for track fragment candidate consisting of two clusters and a missing view
+     *
+     *  @param  pClusterU the cluster from the U view, or nullptr if this is the missing view
+     *  @param  pClusterV the cluster from the V view, or nullptr if this is the missing view
+     *  @param  pClusterW the cluster from the W view, or nullptr if this is the missing view
+     *  @param  pBestMatchedCluster to receive the address of the best matched cluster
+     *  @param  fragmentOverlapResult to receive the populated fragment overlap result
+     *
+     *  @return statusCode, faster than throwing in regular use-cases
+     */
+    pandora::StatusCode CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
+        const pandora::Cluster *const pClusterW, const pandora::Cluster *&pBestMatchedCluster, FragmentOverlapResult &fragmentOverlapResult) const;
+
+    /**
+     *  @brief  Store a newly calculated overlap result in the overlap tensor, replacing any existing overlap result where necessary
+     *
+     *  @param  pClusterU the cluster from the U view, or nullptr if this is the missing view
+     *  @param  pClusterV the cluster from the V view, or nullptr if this is the missing view
+     *  @param  pClusterW the cluster from the W view, or nullptr if this is the missing view
+     *  @param  statusCode the status code returned by the overlap result calculation
+     *  @param  pBestMatchedCluster the address of the best matched cluster
+     *  @param  newOverlapResult the newly calculated fragment overlap result
+     */
+    void StoreOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW,
+        const pandora::StatusCode statusCode, const pandora::Cluster *const pBestMatchedCluster, const FragmentOverlapResult &newOverlapResult);
+
     /**
      *  @brief  Calculate overlap result for track fragment candidate consisting of two sliding fit results and a list of available clusters
      *
@@ -153,6 +194,7 @@ protected:
     float m_maxPointDisplacementSquared;     ///< maximum allowed distance (squared) between projected points and associated hits
     float m_minMatchedSamplingPointFraction; ///< minimum fraction of matched sampling points
     unsigned int m_minMatchedHits;           ///< minimum number of matched calo hits
+    unsigned int m_nThreads;                 ///< The number of threads across which to calculate overlap results (0 for hardware concurrency)
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
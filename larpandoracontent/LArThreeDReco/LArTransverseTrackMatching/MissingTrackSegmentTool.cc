@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
@@ -214,7 +215,9 @@ void MissingTrackSegmentTool::GetSlidingFitResultMap(ThreeViewTransverseTracksAl
 
         try
         {
-            const TwoDSlidingFitResult slidingFitResult(pCluster, pAlgorithm->GetSlidingFitWindow(), slidingFitPitch);
+            LArSlidingFitCacheHelper::TwoDSlidingFitResultPtr pUncachedFitResult;
+            const TwoDSlidingFitResult &slidingFitResult(LArSlidingFitCacheHelper::GetTwoDSlidingFitResult(
+                this->GetPandora(), pCluster, pAlgorithm->GetSlidingFitWindow(), slidingFitPitch, pUncachedFitResult));
             (void)slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult));
             continue;
         }
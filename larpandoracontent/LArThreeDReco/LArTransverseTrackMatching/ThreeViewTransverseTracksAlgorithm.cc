@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArTransverseTrackMatching/ThreeViewTransverseTracksAlgorithm.h"
 
@@ -26,7 +27,8 @@ ThreeViewTransverseTracksAlgorithm::ThreeViewTransverseTracksAlgorithm() :
     m_minSegmentMatchedPoints(3),
     m_minOverallMatchedFraction(0.5f),
     m_minOverallMatchedPoints(10),
-    m_minSamplingPointsPerLayer(0.1f)
+    m_minSamplingPointsPerLayer(0.1f),
+    m_nThreads(1)
 {
 }
 
@@ -44,8 +46,25 @@ void ThreeViewTransverseTracksAlgorithm::CalculateOverlapResult(const Cluster *c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode ThreeViewTransverseTracksAlgorithm::CalculateOverlapResult(
-    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW, TransverseOverlapResult &overlapResult)
+void ThreeViewTransverseTracksAlgorithm::CalculateOverlapResults(
+    const ClusterVector &clusterVectorU, const ClusterVector &clusterVectorV, const ClusterVector &clusterVectorW)
+{
+    if (m_nThreads < 2)
+        return BaseAlgorithm::CalculateOverlapResults(clusterVectorU, clusterVectorV, clusterVectorW);
+
+    // ATTN No fit segment overlap, and hence no overlap result, is possible unless the fit segment x spans of all three clusters overlap
+    this->GetMatchingControl().CalculateOverlapResults(clusterVectorU, clusterVectorV, clusterVectorW, m_nThreads,
+        std::numeric_limits<float>::epsilon(),
+        [this](const Cluster *const pCluster, float &minX, float &maxX) { this->GetFitSegmentXSpan(pCluster, minX, maxX); },
+        [this](const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW, TransverseOverlapResult &overlapResult) {
+            return this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+        });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ThreeViewTransverseTracksAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV,
+    const Cluster *const pClusterW, TransverseOverlapResult &overlapResult) const
 {
     const TwoDSlidingFitResult &slidingFitResultU(this->GetCachedSlidingFitResult(pClusterU));
     const TwoDSlidingFitResult &slidingFitResultV(this->GetCachedSlidingFitResult(pClusterV));
@@ -84,6 +103,20 @@ StatusCode ThreeViewTransverseTracksAlgorithm::CalculateOverlapResult(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeViewTransverseTracksAlgorithm::GetFitSegmentXSpan(const Cluster *const pCluster, float &minX, float &maxX) const
+{
+    minX = std::numeric_limits<float>::max();
+    maxX = -std::numeric_limits<float>::max();
+
+    for (const FitSegment &fitSegment : this->GetCachedSlidingFitResult(pCluster).GetFitSegmentList())
+    {
+        minX = std::min(minX, static_cast<float>(fitSegment.GetMinX()));
+        maxX = std::max(maxX, static_cast<float>(fitSegment.GetMaxX()));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeViewTransverseTracksAlgorithm::GetFitSegmentTensor(const TwoDSlidingFitResult &slidingFitResultU,
     const TwoDSlidingFitResult &slidingFitResultV, const TwoDSlidingFitResult &slidingFitResultW, FitSegmentTensor &fitSegmentTensor) const
 {
@@ -355,6 +388,9 @@ StatusCode ThreeViewTransverseTracksAlgorithm::ReadSettings(const TiXmlHandle xm
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "MinSamplingPointsPerLayer", m_minSamplingPointsPerLayer));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NThreads", m_nThreads));
+    m_nThreads = LArThreadingHelper::GetNThreads(m_nThreads);
+
     return BaseAlgorithm::ReadSettings(xmlHandle);
 }
 
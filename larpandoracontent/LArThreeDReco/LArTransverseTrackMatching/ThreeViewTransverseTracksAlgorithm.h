@@ -42,9 +42,12 @@ private:
     typedef std::map<unsigned int, FitSegmentMatrix> FitSegmentTensor;
 
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    void CalculateOverlapResults(
+        const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV, const pandora::ClusterVector &clusterVectorW);
 
     /**
-     *  @brief  Calculate the overlap result for given group of clusters
+     *  @brief  Calculate the overlap result for given group of clusters. Reads only the cached sliding fits, the geometry and the settings,
+     *          so may be called concurrently
      *
      *  @param  pClusterU the cluster from the U view
      *  @param  pClusterV the cluster from the V view
@@ -54,7 +57,16 @@ private:
      *  @return statusCode, faster than throwing in regular use-cases
      */
     pandora::StatusCode CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
-        const pandora::Cluster *const pClusterW, TransverseOverlapResult &overlapResult);
+        const pandora::Cluster *const pClusterW, TransverseOverlapResult &overlapResult) const;
+
+    /**
+     *  @brief  Get the x span of the fit segments of the cached sliding fit result for a cluster
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  minX to receive the minimum x coordinate
+     *  @param  maxX to receive the maximum x coordinate
+     */
+    void GetFitSegmentXSpan(const pandora::Cluster *const pCluster, float &minX, float &maxX) const;
 
     /**
      *  @brief  Get the number of matched points for three fit segments and accompanying sliding fit results
@@ -117,6 +129,7 @@ private:
     float m_minOverallMatchedFraction;      ///< The minimum matched sampling fraction to allow particle creation
     unsigned int m_minOverallMatchedPoints; ///< The minimum number of matched segment sampling points to allow particle creation
     float m_minSamplingPointsPerLayer;      ///< The minimum number of sampling points per layer to allow particle creation
+    unsigned int m_nThreads;                ///< The number of threads across which to calculate overlap results (0 for hardware concurrency)
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -26,6 +26,7 @@ TwoViewTransverseTracksAlgorithm::TwoViewTransverseTracksAlgorithm() :
     m_minSamples(11),
     m_nPermutations(1000),
     m_localMatchingScoreThreshold(0.99f),
+    m_stopLocalPermutationTestsEarly(false),
     m_maxDotProduct(0.998f),
     m_minOverallMatchingScore(0.1f),
     m_minOverallLocallyMatchedFraction(0.1f),
@@ -155,6 +156,10 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
     pandora::FloatVector localValues1, localValues2;
     unsigned int nMatchedComparisons(0);
 
+    const LArDiscreteProbabilityHelper::PValueDecisionFunction isLocallyMatched = [&](const float localPValue) {
+        return ((1.f - localPValue) - m_localMatchingScoreThreshold > std::numeric_limits<float>::epsilon());
+    };
+
     for (unsigned int iValue = 0; iValue < discreteProbabilityVector1.GetSize(); ++iValue)
     {
         localValues1.emplace_back(discreteProbabilityVector1.GetProbability(iValue));
@@ -164,8 +169,17 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
             float localPValue(0);
             try
             {
-                localPValue = LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
-                    localValues1, localValues2, randomNumberGenerator, m_nPermutations);
+                if (m_stopLocalPermutationTestsEarly)
+                {
+                    // ATTN Only the local matching decision is required, so stop once this is decided
+                    localPValue = LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+                        localValues1, localValues2, randomNumberGenerator, m_nPermutations, isLocallyMatched);
+                }
+                else
+                {
+                    localPValue = LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+                        localValues1, localValues2, randomNumberGenerator, m_nPermutations);
+                }
             }
             catch (const StatusCodeException &)
             {
@@ -181,7 +195,7 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
                 std::cout << std::endl;
             }
 
-            if ((1.f - localPValue) - m_localMatchingScoreThreshold > std::numeric_limits<float>::epsilon())
+            if (isLocallyMatched(localPValue))
                 nMatchedComparisons++;
 
             localValues1.erase(localValues1.begin());
@@ -259,6 +273,9 @@ StatusCode TwoViewTransverseTracksAlgorithm::ReadSettings(const TiXmlHandle xmlH
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "LocalMatchingScoreThreshold", m_localMatchingScoreThreshold));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "StopLocalPermutationTestsEarly", m_stopLocalPermutationTestsEarly));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxDotProduct", m_maxDotProduct));
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
@@ -34,6 +34,7 @@ StatusCode ClusterAssociationAlgorithm::Run()
     ClusterAssociationMap clusterAssociationMap;
     this->PopulateClusterAssociationMap(clusterVector, clusterAssociationMap);
 
+    m_clusterListIndex.Reset(*pClusterList);
     m_mergeMade = true;
 
     while (m_mergeMade)
@@ -45,8 +46,8 @@ StatusCode ClusterAssociationAlgorithm::Run()
 
             for (const Cluster *const pCluster : clusterVector)
             {
-                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against managed cluster list
-                if (pClusterList->end() == std::find(pClusterList->begin(), pClusterList->end(), pCluster))
+                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against managed cluster list index
+                if (!m_clusterListIndex.IsPresent(pCluster))
                     continue;
 
                 this->UnambiguousPropagation(pCluster, true, clusterAssociationMap);
@@ -79,6 +80,8 @@ StatusCode ClusterAssociationAlgorithm::Run()
         }
     }
 
+    m_clusterListIndex.Clear();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -111,6 +114,7 @@ void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pC
     this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForward, clusterAssociationMap);
 
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pClusterToEnlarge, pClusterToDelete));
+    m_clusterListIndex.RemoveObject(pClusterToDelete);
     m_mergeMade = true;
 
     this->UnambiguousPropagation(pClusterToEnlarge, isForward, clusterAssociationMap);
@@ -154,6 +158,7 @@ void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pClu
         this->UpdateForAmbiguousMerge(*dIter, clusterAssociationMap);
 
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pCluster, *dIter));
+        m_clusterListIndex.RemoveObject(*dIter);
         m_mergeMade = true;
         *dIter = NULL;
     }
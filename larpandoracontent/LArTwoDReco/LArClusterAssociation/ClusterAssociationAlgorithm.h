@@ -10,6 +10,8 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArManagedListIndex.h"
+
 #include <unordered_map>
 
 namespace lar_content
@@ -121,6 +123,7 @@ private:
         const bool isForward, const pandora::Cluster *&pExtremalCluster, pandora::ClusterSet &clusterSet) const;
 
     mutable bool m_mergeMade;
+    mutable ClusterListIndex m_clusterListIndex; ///< The index of the current cluster list, updated as clusters are deleted in merges
 
     bool m_resolveAmbiguousAssociations; ///< Whether to resolve ambiguous associations
 };
@@ -16,7 +16,7 @@ namespace lar_content
 {
 
 template <typename, unsigned int>
-class KDTreeLinkerAlgo;
+class KDTreeLinkerFlatAlgo;
 template <typename, unsigned int>
 class KDTreeNodeInfoT;
 
@@ -93,7 +93,7 @@ private:
 
     typedef std::vector<LArTransverseCluster *> TransverseClusterList;
 
-    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeLinkerFlatAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
     typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
 
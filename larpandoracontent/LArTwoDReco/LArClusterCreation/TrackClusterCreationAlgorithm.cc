@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterCreation/TrackClusterCreationAlgorithm.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -36,9 +38,14 @@ StatusCode TrackClusterCreationAlgorithm::Run()
     OrderedCaloHitList selectedCaloHitList, rejectedCaloHitList;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->FilterCaloHits(pCaloHitList, selectedCaloHitList, rejectedCaloHitList));
 
+    LayerHitsVector layerHitsVector;
+
+    for (const OrderedCaloHitList::value_type &layerEntry : selectedCaloHitList)
+        layerHitsVector.emplace_back(layerEntry.first, *layerEntry.second);
+
     HitAssociationMap forwardHitAssociationMap, backwardHitAssociationMap;
-    this->MakePrimaryAssociations(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
-    this->MakeSecondaryAssociations(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
+    this->MakePrimaryAssociations(layerHitsVector, forwardHitAssociationMap, backwardHitAssociationMap);
+    this->MakeSecondaryAssociations(layerHitsVector, forwardHitAssociationMap, backwardHitAssociationMap);
 
     HitJoinMap hitJoinMap;
     HitToClusterMap hitToClusterMap;
@@ -181,29 +188,30 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHitList &orderedCaloHitList,
-    HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
+void TrackClusterCreationAlgorithm::MakePrimaryAssociations(
+    const LayerHitsVector &layerHitsVector, HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
 {
-    for (OrderedCaloHitList::const_iterator iterI = orderedCaloHitList.begin(), iterIEnd = orderedCaloHitList.end(); iterI != iterIEnd; ++iterI)
+    LayerHits::IndexVector candidateIndices;
+
+    for (LayerHitsVector::const_iterator iterI = layerHitsVector.begin(), iterIEnd = layerHitsVector.end(); iterI != iterIEnd; ++iterI)
     {
         unsigned int nLayersConsidered(0);
 
-        CaloHitVector caloHitsI(iterI->second->begin(), iterI->second->end());
-        std::sort(caloHitsI.begin(), caloHitsI.end(), LArClusterHelper::SortHitsByPosition);
-
-        for (OrderedCaloHitList::const_iterator iterJ = iterI, iterJEnd = orderedCaloHitList.end();
+        for (LayerHitsVector::const_iterator iterJ = iterI, iterJEnd = layerHitsVector.end();
              (nLayersConsidered++ <= m_maxGapLayers + 1) && (iterJ != iterJEnd); ++iterJ)
         {
-            if (iterJ->first == iterI->first || iterJ->first > iterI->first + m_maxGapLayers + 1)
+            if (iterJ->GetPseudoLayer() == iterI->GetPseudoLayer() || iterJ->GetPseudoLayer() > iterI->GetPseudoLayer() + m_maxGapLayers + 1)
                 continue;
 
-            CaloHitVector caloHitsJ(iterJ->second->begin(), iterJ->second->end());
-            std::sort(caloHitsJ.begin(), caloHitsJ.end(), LArClusterHelper::SortHitsByPosition);
+            const CaloHitVector &caloHitsJ(iterJ->GetCaloHits());
 
-            for (const CaloHit *const pCaloHitI : caloHitsI)
+            for (const CaloHit *const pCaloHitI : iterI->GetCaloHits())
             {
-                for (const CaloHit *const pCaloHitJ : caloHitsJ)
-                    this->CreatePrimaryAssociation(pCaloHitI, pCaloHitJ, forwardHitAssociationMap, backwardHitAssociationMap);
+                // ATTN Hits outside the x window cannot pass the separation cut; the rest are visited in position order, preserving tie-breaks
+                iterJ->GetCandidateIndices(pCaloHitI->GetPositionVector().GetX(), m_maxCaloHitSeparationSquared, candidateIndices);
+
+                for (const unsigned int index : candidateIndices)
+                    this->CreatePrimaryAssociation(pCaloHitI, caloHitsJ[index], forwardHitAssociationMap, backwardHitAssociationMap);
             }
         }
     }
@@ -211,15 +219,12 @@ void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::MakeSecondaryAssociations(const OrderedCaloHitList &orderedCaloHitList,
-    HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
+void TrackClusterCreationAlgorithm::MakeSecondaryAssociations(
+    const LayerHitsVector &layerHitsVector, HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
 {
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    for (const LayerHits &layerHits : layerHitsVector)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
-        std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
-
-        for (const CaloHit *const pCaloHit : caloHits)
+        for (const CaloHit *const pCaloHit : layerHits.GetCaloHits())
         {
             HitAssociationMap::const_iterator fwdIter = forwardHitAssociationMap.find(pCaloHit);
             const CaloHit *const pForwardHit((forwardHitAssociationMap.end() == fwdIter) ? NULL : fwdIter->second.GetPrimaryTarget());
@@ -462,4 +467,45 @@ StatusCode TrackClusterCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHand
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TrackClusterCreationAlgorithm::LayerHits::LayerHits(const unsigned int pseudoLayer, const CaloHitList &caloHitList) :
+    m_pseudoLayer(pseudoLayer),
+    m_caloHits(caloHitList.begin(), caloHitList.end())
+{
+    std::sort(m_caloHits.begin(), m_caloHits.end(), LArClusterHelper::SortHitsByPosition);
+    m_xIndices.reserve(m_caloHits.size());
+
+    for (unsigned int index = 0; index < m_caloHits.size(); ++index)
+        m_xIndices.emplace_back(m_caloHits[index]->GetPositionVector().GetX(), index);
+
+    std::sort(m_xIndices.begin(), m_xIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackClusterCreationAlgorithm::LayerHits::GetCandidateIndices(const float x, const float maxSeparationSquared, IndexVector &indices) const
+{
+    // ATTN Use the same single precision difference as the full separation, which can be no smaller than its x component alone
+    CoordinateIndexVector::const_iterator windowBegin(std::partition_point(m_xIndices.begin(), m_xIndices.end(),
+        [x, maxSeparationSquared](const CoordinateIndexVector::value_type &entry) {
+            const float deltaX(entry.first - x);
+            return ((deltaX < 0.f) && (deltaX * deltaX > maxSeparationSquared));
+        }));
+
+    CoordinateIndexVector::const_iterator windowEnd(
+        std::partition_point(windowBegin, m_xIndices.end(), [x, maxSeparationSquared](const CoordinateIndexVector::value_type &entry) {
+            const float deltaX(entry.first - x);
+            return !((deltaX > 0.f) && (deltaX * deltaX > maxSeparationSquared));
+        }));
+
+    indices.clear();
+
+    for (CoordinateIndexVector::const_iterator iter = windowBegin; iter != windowEnd; ++iter)
+        indices.push_back(iter->second);
+
+    std::sort(indices.begin(), indices.end());
+}
+
 } // namespace lar_content
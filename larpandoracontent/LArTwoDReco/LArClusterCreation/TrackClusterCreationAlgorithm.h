@@ -11,6 +11,8 @@
 #include "Pandora/Algorithm.h"
 
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace lar_content
 {
@@ -84,6 +86,55 @@ private:
         float m_secondaryDistanceSquared;           ///< the secondary distance squared
     };
 
+    /**
+     *  @brief  LayerHits class, the hits in a single pseudo layer, sorted by position, with an index in x for windowed neighbour searches
+     */
+    class LayerHits
+    {
+    public:
+        typedef std::vector<unsigned int> IndexVector;
+
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pseudoLayer the pseudo layer
+         *  @param  caloHitList the calo hits in the pseudo layer
+         */
+        LayerHits(const unsigned int pseudoLayer, const pandora::CaloHitList &caloHitList);
+
+        /**
+         *  @brief  Get the pseudo layer
+         *
+         *  @return the pseudo layer
+         */
+        unsigned int GetPseudoLayer() const;
+
+        /**
+         *  @brief  Get the calo hits, sorted by position
+         *
+         *  @return the calo hit vector
+         */
+        const pandora::CaloHitVector &GetCaloHits() const;
+
+        /**
+         *  @brief  Get the indices, in the position-sorted calo hit vector, of all hits that could lie within a maximum separation of a
+         *          given x coordinate. Indices are returned in increasing order, so hits are visited in position-sorted order.
+         *
+         *  @param  x the x coordinate
+         *  @param  maxSeparationSquared the maximum separation squared
+         *  @param  indices to receive the candidate indices
+         */
+        void GetCandidateIndices(const float x, const float maxSeparationSquared, IndexVector &indices) const;
+
+    private:
+        typedef std::vector<std::pair<float, unsigned int>> CoordinateIndexVector;
+
+        unsigned int m_pseudoLayer;        ///< The pseudo layer
+        pandora::CaloHitVector m_caloHits; ///< The calo hits, sorted by position
+        CoordinateIndexVector m_xIndices;  ///< The calo hit x coordinates and position-sorted indices, sorted by x coordinate
+    };
+
+    typedef std::vector<LayerHits> LayerHitsVector;
     typedef std::unordered_map<const pandora::CaloHit *, HitAssociation> HitAssociationMap;
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::CaloHit *> HitJoinMap;
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
@@ -114,22 +165,22 @@ private:
     /**
      *  @brief  Control primary association formation
      *
-     *  @param  orderedCaloHitList the ordered calo hit list
+     *  @param  layerHitsVector the position-sorted hits in each pseudo layer, ordered by pseudo layer
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      */
-    void MakePrimaryAssociations(const pandora::OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
-        HitAssociationMap &backwardHitAssociationMap) const;
+    void MakePrimaryAssociations(
+        const LayerHitsVector &layerHitsVector, HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const;
 
     /**
      *  @brief  Control secondary association formation
      *
-     *  @param  orderedCaloHitList the ordered calo hit list
+     *  @param  layerHitsVector the position-sorted hits in each pseudo layer, ordered by pseudo layer
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      */
-    void MakeSecondaryAssociations(const pandora::OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
-        HitAssociationMap &backwardHitAssociationMap) const;
+    void MakeSecondaryAssociations(
+        const LayerHitsVector &layerHitsVector, HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const;
 
     /**
      *  @brief  Identify final hit joins for use in cluster formation
@@ -251,6 +302,21 @@ inline float TrackClusterCreationAlgorithm::HitAssociation::GetSecondaryDistance
     return m_secondaryDistanceSquared;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int TrackClusterCreationAlgorithm::LayerHits::GetPseudoLayer() const
+{
+    return m_pseudoLayer;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHitVector &TrackClusterCreationAlgorithm::LayerHits::GetCaloHits() const
+{
+    return m_caloHits;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_TRACK_CLUSTER_CREATION_ALGORITHM_H
@@ -16,7 +16,7 @@ namespace lar_content
 {
 
 template <typename, unsigned int>
-class KDTreeLinkerAlgo;
+class KDTreeLinkerFlatAlgo;
 template <typename, unsigned int>
 class KDTreeNodeInfoT;
 
@@ -34,7 +34,7 @@ public:
     CrossedTrackSplittingAlgorithm();
 
 private:
-    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeLinkerFlatAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
     typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
 
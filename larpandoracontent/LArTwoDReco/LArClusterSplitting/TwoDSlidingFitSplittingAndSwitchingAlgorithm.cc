@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitSplittingAndSwitchingAlgorithm.h"
 
@@ -140,7 +141,9 @@ void TwoDSlidingFitSplittingAndSwitchingAlgorithm::BuildSlidingFitResultMap(
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, m_halfWindowLayers, slidingFitPitch);
+                LArSlidingFitCacheHelper::TwoDSlidingFitResultPtr pUncachedFitResult;
+                const TwoDSlidingFitResult &slidingFitResult(LArSlidingFitCacheHelper::GetTwoDSlidingFitResult(
+                    this->GetPandora(), *iter, m_halfWindowLayers, slidingFitPitch, pUncachedFitResult));
 
                 if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
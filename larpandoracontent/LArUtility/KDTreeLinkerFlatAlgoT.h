@@ -0,0 +1,1031 @@
+/**
+ *  @file   larpandoracontent/LArUtility/KDTreeLinkerFlatAlgoT.h
+ *
+ *  @brief  Header file for the flat kd tree linker algo template class
+ *
+ *  $Log: $
+ */
+#ifndef LAR_KD_TREE_LINKER_FLAT_ALGO_TEMPLATED_H
+#define LAR_KD_TREE_LINKER_FLAT_ALGO_TEMPLATED_H 1
+
+#include "KDTreeLinkerToolsT.h"
+
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  Class that implements the KDTree partition of space using an implicit, index-based layout. The elements are stored contiguously,
+ *          in tree order, with the coordinates held separately for each dimension. Any range [low, high) of at least two elements is split
+ *          at a median index determined by the range alone, so no child links are needed. The partition, and therefore the order of the
+ *          box search results and the choice of nearest neighbour, is identical to that of KDTreeLinkerAlgo, for which this is a drop-in
+ *          replacement. All queries are const, so a built tree may be queried from several threads at once.
+ *
+ *          Elements may also be inserted and removed after the tree is built. Inserted elements are held in a pending list, which
+ *          queries scan linearly, and removed elements are flagged in place, so neither change restructures the tree. The tree is
+ *          rebuilt lazily, from the remaining elements, only once the number of changes exceeds a fraction of the tree size. Every query
+ *          returns the same elements as a tree freshly built from the remaining elements, but the order of the results, and the choice
+ *          between equidistant neighbours, may differ until the tree is next rebuilt.
+ */
+template <typename DATA, unsigned DIM = 2>
+class KDTreeLinkerFlatAlgo
+{
+public:
+    typedef KDTreeNodeInfoT<DATA, DIM> NodeInfo;
+    typedef std::vector<NodeInfo> NodeInfoList;
+    typedef std::vector<NodeInfoList> NodeInfoListVector;
+    typedef std::vector<KDTreeBoxT<DIM>> BoxVector;
+
+    /**
+     *  @brief  Default constructor
+     */
+    KDTreeLinkerFlatAlgo();
+
+    /**
+     *  @brief  Build the KD tree from the "eltList" in the space define by "region"
+     *
+     *  @param  eltList the elements, copied into the tree
+     *  @param  region the bounding region of the elements
+     */
+    void build(const NodeInfoList &eltList, const KDTreeBoxT<DIM> &region);
+
+    /**
+     *  @brief  Search in the KDTree for all points that would be contained in the given searchbox
+     *          The founded points are stored in resRecHitList
+     *
+     *  @param  searchBox the search box
+     *  @param  resRecHitList to receive the points in the search box
+     */
+    void search(const KDTreeBoxT<DIM> &searchBox, NodeInfoList &resRecHitList) const;
+
+    /**
+     *  @brief  Search in the KDTree for the points contained in each of a list of search boxes
+     *
+     *  @param  searchBoxes the search boxes
+     *  @param  resRecHitLists to receive the points in each search box, indexed as the search boxes
+     *  @param  nThreads the number of threads over which to distribute the searches
+     */
+    void search(const BoxVector &searchBoxes, NodeInfoListVector &resRecHitLists, const unsigned nThreads = 1) const;
+
+    /**
+     *  @brief  findNearestNeighbour
+     *
+     *  @param  point the target point
+     *  @param  result to receive the address of the nearest neighbour, owned by the tree (nullptr if the tree is empty)
+     *  @param  distance to receive the distance to the nearest neighbour
+     */
+    void findNearestNeighbour(const NodeInfo &point, const NodeInfo *&result, float &distance) const;
+
+    /**
+     *  @brief  Find the k nearest neighbours of a point, in order of increasing distance
+     *
+     *  @param  point the target point
+     *  @param  k the number of neighbours to find
+     *  @param  result to receive the (at most k) nearest neighbours
+     *  @param  distances to receive the distances to the nearest neighbours, indexed as the result
+     */
+    void findKNearestNeighbours(const NodeInfo &point, const unsigned k, NodeInfoList &result, std::vector<float> &distances) const;
+
+    /**
+     *  @brief  Search in the KDTree for all points within a given distance of a point
+     *
+     *  @param  point the target point
+     *  @param  radius the search radius
+     *  @param  result to receive the points within the search radius
+     */
+    void searchRadius(const NodeInfo &point, const float radius, NodeInfoList &result) const;
+
+    /**
+     *  @brief  Search in the KDTree for all points within a given distance of each of a list of points
+     *
+     *  @param  points the target points
+     *  @param  radius the search radius
+     *  @param  results to receive the points within the search radius of each target point, indexed as the target points
+     *  @param  nThreads the number of threads over which to distribute the searches
+     */
+    void searchRadius(const NodeInfoList &points, const float radius, NodeInfoListVector &results, const unsigned nThreads = 1) const;
+
+    /**
+     *  @brief  Insert an element into the tree
+     *
+     *  @param  elt the element
+     */
+    void insert(const NodeInfo &elt);
+
+    /**
+     *  @brief  Insert a list of elements into the tree, considering a rebuild only once all have been inserted
+     *
+     *  @param  eltList the elements
+     */
+    void insert(const NodeInfoList &eltList);
+
+    /**
+     *  @brief  Remove an element, matching in both data and coordinates, from the tree
+     *
+     *  @param  elt the element
+     *
+     *  @return whether the element was found and removed
+     */
+    bool remove(const NodeInfo &elt);
+
+    /**
+     *  @brief  Remove a list of elements, each matching in both data and coordinates, from the tree, considering a rebuild only once all
+     *          have been removed
+     *
+     *  @param  eltList the elements
+     *
+     *  @return the number of elements found and removed
+     */
+    unsigned remove(const NodeInfoList &eltList);
+
+    /**
+     *  @brief  Set the thresholds controlling when the tree is rebuilt following insertions and removals
+     *
+     *  @param  maxChangeFraction the number of changes, as a fraction of the number of elements in the tree, above which to rebuild
+     *  @param  minChangesForRebuild the number of changes at or below which the tree is never rebuilt
+     */
+    void setRebuildThresholds(const float maxChangeFraction, const unsigned minChangesForRebuild);
+
+    /**
+     *  @brief  Whether the tree is empty
+     *
+     *  @return boolean
+     */
+    bool empty() const;
+
+    /**
+     *  @brief  Return the number of nodes + leaves in the tree (nElements should be (size() +1) / 2)
+     *
+     *  @return the number of nodes + leaves in the tree
+     */
+    int size() const;
+
+    /**
+     *  @brief  Clear all allocated structures
+     */
+    void clear();
+
+private:
+    typedef std::pair<float, unsigned> DistanceIndexPair;
+    typedef std::vector<DistanceIndexPair> DistanceIndexPairVector;
+
+    /**
+     *  @brief  Rebuild the tree from its remaining and pending elements, if the number of changes since it was built exceeds the thresholds
+     */
+    void rebuildIfNeeded();
+
+    /**
+     *  @brief  Remove an element, matching in both data and coordinates, from the tree or the pending elements, without any rebuild
+     *
+     *  @param  elt the element
+     *
+     *  @return whether the element was found and removed
+     */
+    bool removeElement(const NodeInfo &elt);
+
+    /**
+     *  @brief  Recursive element removal. Is called by removeElement()
+     *
+     *  @param  low the first index in the range
+     *  @param  high one past the last index in the range
+     *  @param  depth the tree depth
+     *  @param  elt the element to remove
+     *
+     *  @return whether the element was found and removed
+     */
+    bool recRemove(const unsigned low, const unsigned high, const unsigned depth, const NodeInfo &elt);
+
+    /**
+     *  @brief  Add a candidate to the max-heap of k nearest neighbour candidates, if it is closer than the current furthest candidate
+     *
+     *  @param  candidate the candidate squared distance and index
+     *  @param  k the number of neighbours to find
+     *  @param  heap the max-heap of the current best candidates, by squared distance
+     */
+    static void addCandidate(const DistanceIndexPair &candidate, const unsigned k, DistanceIndexPairVector &heap);
+
+    /**
+     *  @brief  Whether two elements match in both data and coordinates
+     *
+     *  @param  a the first element
+     *  @param  b the second element
+     *
+     *  @return boolean
+     */
+    static bool isSameElement(const NodeInfo &a, const NodeInfo &b);
+
+    /**
+     *  @brief  Get the index of the median element of a range, which is also the index of the node splitting the range
+     *
+     *  @param  low the first index in the range
+     *  @param  high one past the last index in the range
+     *
+     *  @return the median index
+     */
+    static unsigned medianIndex(const unsigned low, const unsigned high);
+
+    /**
+     *  @brief  Fast median search with Wirth algorithm in the element list between low and high indexes.
+     *
+     *  @param  low the first index in the range
+     *  @param  high one past the last index in the range
+     *  @param  treeDepth the tree depth
+     */
+    void medianSearch(const unsigned low, const unsigned high, const unsigned treeDepth);
+
+    /**
+     *  @brief  Recursive kdtree builder. Is called by build()
+     *
+     *  @param  low the first index in the range
+     *  @param  high one past the last index in the range
+     *  @param  depth the tree depth
+     */
+    void recBuild(const unsigned low, const unsigned high, const unsigned depth);
+
+    /**
+     *  @brief  Recursive kdtree search. Is called by search()
+     *
+     *  @param  low the first index in the range
+     *  @param  high one past the last index in the range
+     *  @param  depth the tree depth
+     *  @param  region the region spanned by the range
+     *  @param  trackBox the search box
+     *  @param  result to receive the points in the search box
+     */
+    void recSearch(const unsigned low, const unsigned high, const unsigned depth, const KDTreeBoxT<DIM> &region, const KDTreeBoxT<DIM> &trackBox,
+        NodeInfoList &result) const;
+
+    /**
+     *  @brief  Search a child range, adding all of its elements if its region is fully contained in the search box
+     *
+     *  @param  low the first index in the range
+     *  @param  high one past the last index in the range
+     *  @param  depth the tree depth of the child
+     *  @param  region the region spanned by the child range
+     *  @param  trackBox the search box
+     *  @param  result to receive the points in the search box
+     */
+    void searchChild(const unsigned low, const unsigned high, const unsigned depth, const KDTreeBoxT<DIM> &region, const KDTreeBoxT<DIM> &trackBox,
+        NodeInfoList &result) const;
+
+    /**
+     *  @brief  Recursive nearest neighbour search. Is called by findNearestNeighbour()
+     *
+     *  @param  low the first index in the range
+     *  @param  high one past the last index in the range
+     *  @param  depth the tree depth
+     *  @param  point the target point
+     *  @param  pBestMatch the address of the best match
+     *  @param  bestDist2 the squared distance to the best match
+     */
+    void recNearestNeighbour(const unsigned low, const unsigned high, const unsigned depth, const NodeInfo &point, const NodeInfo *&pBestMatch,
+        float &bestDist2) const;
+
+    /**
+     *  @brief  Recursive k nearest neighbour search. Is called by findKNearestNeighbours()
+     *
+     *  @param  low the first index in the range
+     *  @param  high one past the last index in the range
+     *  @param  depth the tree depth
+     *  @param  point the target point
+     *  @param  k the number of neighbours to find
+     *  @param  heap the max-heap of the current best candidates, by squared distance
+     */
+    void recKNearestNeighbours(const unsigned low, const unsigned high, const unsigned depth, const NodeInfo &point, const unsigned k,
+        DistanceIndexPairVector &heap) const;
+
+    /**
+     *  @brief  Recursive radius search. Is called by searchRadius()
+     *
+     *  @param  low the first index in the range
+     *  @param  high one past the last index in the range
+     *  @param  depth the tree depth
+     *  @param  point the target point
+     *  @param  radius the search radius
+     *  @param  result to receive the points within the search radius
+     */
+    void recSearchRadius(const unsigned low, const unsigned high, const unsigned depth, const NodeInfo &point, const float radius, NodeInfoList &result) const;
+
+    /**
+     *  @brief  Get the squared distance between a point and a stored element
+     *
+     *  @param  point the point
+     *  @param  index the index of the stored element
+     *
+     *  @return the squared distance
+     */
+    float dist2(const NodeInfo &point, const unsigned index) const;
+
+    /**
+     *  @brief  dist2
+     *
+     *  @param  a
+     *  @param  b
+     *
+     *  @return dist2
+     */
+    float dist2(const NodeInfo &a, const NodeInfo &b) const;
+
+    NodeInfoList m_elements;                           ///< The elements, in tree order, each a leaf of the tree
+    std::array<std::vector<float>, DIM> m_coordinates; ///< The coordinates of the elements, one contiguous list per dimension
+    NodeInfoList m_nodeInfos;                          ///< The median element of each node, indexed by the median index of the node range
+    std::vector<float> m_splitValues;                  ///< The split value of each node, indexed by the median index of the node range
+    KDTreeBoxT<DIM> m_region;                          ///< The region spanned by the tree
+    std::vector<bool> m_isRemoved;                     ///< Whether each element has been removed since the tree was built
+    std::vector<bool> m_isNodeRemoved;                 ///< Whether the median element of each node has been removed since the tree was built
+    unsigned m_nRemoved;                               ///< The number of elements removed since the tree was built
+    NodeInfoList m_pendingElements;                    ///< The elements inserted since the tree was built
+    float m_maxChangeFraction;                         ///< The number of changes, as a fraction of the tree size, above which to rebuild
+    unsigned m_minChangesForRebuild;                   ///< The number of changes at or below which the tree is never rebuilt
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline KDTreeLinkerFlatAlgo<DATA, DIM>::KDTreeLinkerFlatAlgo() :
+    m_nRemoved(0),
+    m_maxChangeFraction(0.1f),
+    m_minChangesForRebuild(32)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::build(const NodeInfoList &eltList, const KDTreeBoxT<DIM> &region)
+{
+    this->clear();
+
+    if (eltList.empty())
+        return;
+
+    m_elements = eltList;
+    m_region = region;
+
+    const unsigned nElements(m_elements.size());
+    m_nodeInfos.resize(nElements - 1);
+    m_splitValues.resize(nElements - 1);
+
+    m_isRemoved.assign(nElements, false);
+    m_isNodeRemoved.assign(nElements - 1, false);
+
+    this->recBuild(0, nElements, 0);
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        m_coordinates[i].resize(nElements);
+
+        for (unsigned index = 0; index < nElements; ++index)
+            m_coordinates[i][index] = m_elements[index].dims[i];
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &searchBox, NodeInfoList &resRecHitList) const
+{
+    if (!m_elements.empty())
+        this->recSearch(0, m_elements.size(), 0, m_region, searchBox, resRecHitList);
+
+    for (const NodeInfo &pendingElement : m_pendingElements)
+    {
+        bool isInside(true);
+
+        for (unsigned i = 0; i < DIM; ++i)
+            isInside = isInside && pendingElement.dims[i] >= searchBox.dimmin[i] && pendingElement.dims[i] <= searchBox.dimmax[i];
+
+        if (isInside)
+            resRecHitList.push_back(pendingElement);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::search(const BoxVector &searchBoxes, NodeInfoListVector &resRecHitLists, const unsigned nThreads) const
+{
+    resRecHitLists.resize(searchBoxes.size());
+
+    LArThreadingHelper::ParallelFor(searchBoxes.size(), nThreads, [&](const unsigned index) {
+        this->search(searchBoxes[index], resRecHitLists[index]);
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::findNearestNeighbour(const NodeInfo &point, const NodeInfo *&result, float &distance) const
+{
+    result = nullptr;
+    distance = std::numeric_limits<float>::max();
+
+    const NodeInfo *pBestMatch(nullptr);
+
+    if (!m_elements.empty())
+        this->recNearestNeighbour(0, m_elements.size(), 0, point, pBestMatch, distance);
+
+    for (const NodeInfo &pendingElement : m_pendingElements)
+    {
+        const float distPending(this->dist2(point, pendingElement));
+
+        if (distPending < distance)
+        {
+            distance = distPending;
+            pBestMatch = &pendingElement;
+        }
+    }
+
+    if (distance != std::numeric_limits<float>::max())
+    {
+        result = pBestMatch;
+        distance = std::sqrt(distance);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::findKNearestNeighbours(
+    const NodeInfo &point, const unsigned k, NodeInfoList &result, std::vector<float> &distances) const
+{
+    result.clear();
+    distances.clear();
+
+    if (this->empty() || (0 == k))
+        return;
+
+    DistanceIndexPairVector heap;
+    heap.reserve(std::min(k, static_cast<unsigned>(m_elements.size() + m_pendingElements.size())));
+
+    if (!m_elements.empty())
+        this->recKNearestNeighbours(0, m_elements.size(), 0, point, k, heap);
+
+    // ATTN Pending elements are indexed after the elements in the tree
+    for (unsigned index = 0; index < m_pendingElements.size(); ++index)
+        KDTreeLinkerFlatAlgo::addCandidate(DistanceIndexPair(this->dist2(point, m_pendingElements[index]), m_elements.size() + index), k, heap);
+
+    // ATTN Ties in distance are resolved by tree order, so that the result does not depend on the order of the heap operations
+    std::sort(heap.begin(), heap.end());
+
+    for (const DistanceIndexPair &distanceIndexPair : heap)
+    {
+        const unsigned index(distanceIndexPair.second);
+        result.push_back((index < m_elements.size()) ? m_elements[index] : m_pendingElements[index - m_elements.size()]);
+        distances.push_back(std::sqrt(distanceIndexPair.first));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::searchRadius(const NodeInfo &point, const float radius, NodeInfoList &result) const
+{
+    if (radius < 0.f)
+        return;
+
+    if (!m_elements.empty())
+        this->recSearchRadius(0, m_elements.size(), 0, point, radius, result);
+
+    for (const NodeInfo &pendingElement : m_pendingElements)
+    {
+        if (this->dist2(point, pendingElement) <= radius * radius)
+            result.push_back(pendingElement);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::searchRadius(
+    const NodeInfoList &points, const float radius, NodeInfoListVector &results, const unsigned nThreads) const
+{
+    results.resize(points.size());
+
+    LArThreadingHelper::ParallelFor(points.size(), nThreads, [&](const unsigned index) {
+        this->searchRadius(points[index], radius, results[index]);
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::insert(const NodeInfo &elt)
+{
+    m_pendingElements.push_back(elt);
+    this->rebuildIfNeeded();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::insert(const NodeInfoList &eltList)
+{
+    m_pendingElements.insert(m_pendingElements.end(), eltList.begin(), eltList.end());
+    this->rebuildIfNeeded();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool KDTreeLinkerFlatAlgo<DATA, DIM>::remove(const NodeInfo &elt)
+{
+    if (!this->removeElement(elt))
+        return false;
+
+    this->rebuildIfNeeded();
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline unsigned KDTreeLinkerFlatAlgo<DATA, DIM>::remove(const NodeInfoList &eltList)
+{
+    unsigned nRemoved(0);
+
+    for (const NodeInfo &elt : eltList)
+    {
+        if (this->removeElement(elt))
+            ++nRemoved;
+    }
+
+    this->rebuildIfNeeded();
+    return nRemoved;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::setRebuildThresholds(const float maxChangeFraction, const unsigned minChangesForRebuild)
+{
+    m_maxChangeFraction = maxChangeFraction;
+    m_minChangesForRebuild = minChangesForRebuild;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool KDTreeLinkerFlatAlgo<DATA, DIM>::empty() const
+{
+    return ((m_elements.size() == m_nRemoved) && m_pendingElements.empty());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline int KDTreeLinkerFlatAlgo<DATA, DIM>::size() const
+{
+    const unsigned nElements(m_elements.size() - m_nRemoved + m_pendingElements.size());
+    return ((0 == nElements) ? 0 : static_cast<int>(2 * nElements - 1));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::clear()
+{
+    m_elements.clear();
+    m_nodeInfos.clear();
+    m_splitValues.clear();
+    m_isRemoved.clear();
+    m_isNodeRemoved.clear();
+    m_nRemoved = 0;
+    m_pendingElements.clear();
+
+    for (unsigned i = 0; i < DIM; ++i)
+        m_coordinates[i].clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::rebuildIfNeeded()
+{
+    const unsigned nChanges(m_nRemoved + m_pendingElements.size());
+
+    if ((nChanges <= m_minChangesForRebuild) || (nChanges <= m_maxChangeFraction * m_elements.size()))
+        return;
+
+    NodeInfoList eltList;
+    eltList.reserve(m_elements.size() - m_nRemoved + m_pendingElements.size());
+
+    for (unsigned index = 0; index < m_elements.size(); ++index)
+    {
+        if (!m_isRemoved[index])
+            eltList.push_back(m_elements[index]);
+    }
+
+    eltList.insert(eltList.end(), m_pendingElements.begin(), m_pendingElements.end());
+
+    if (eltList.empty())
+    {
+        this->clear();
+        return;
+    }
+
+    KDTreeBoxT<DIM> region;
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        region.dimmin[i] = eltList.front().dims[i];
+        region.dimmax[i] = eltList.front().dims[i];
+
+        for (const NodeInfo &elt : eltList)
+        {
+            region.dimmin[i] = std::min(region.dimmin[i], elt.dims[i]);
+            region.dimmax[i] = std::max(region.dimmax[i], elt.dims[i]);
+        }
+    }
+
+    this->build(eltList, region);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool KDTreeLinkerFlatAlgo<DATA, DIM>::removeElement(const NodeInfo &elt)
+{
+    if (!m_elements.empty() && this->recRemove(0, m_elements.size(), 0, elt))
+        return true;
+
+    typename NodeInfoList::iterator iter(m_pendingElements.begin());
+
+    while ((m_pendingElements.end() != iter) && !KDTreeLinkerFlatAlgo::isSameElement(*iter, elt))
+        ++iter;
+
+    if (m_pendingElements.end() == iter)
+        return false;
+
+    m_pendingElements.erase(iter);
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool KDTreeLinkerFlatAlgo<DATA, DIM>::recRemove(const unsigned low, const unsigned high, const unsigned depth, const NodeInfo &elt)
+{
+    if (high - low == 1)
+    {
+        if (m_isRemoved[low] || !KDTreeLinkerFlatAlgo::isSameElement(m_elements[low], elt))
+            return false;
+
+        m_isRemoved[low] = true;
+        ++m_nRemoved;
+        return true;
+    }
+
+    // ATTN Elements equal to the split value may lie on either side
+    const unsigned median(KDTreeLinkerFlatAlgo::medianIndex(low, high));
+    const float value(elt.dims[depth % DIM]);
+
+    bool isFound((value <= m_splitValues[median]) && this->recRemove(low, median + 1, depth + 1, elt));
+
+    if (!isFound)
+        isFound = (value >= m_splitValues[median]) && this->recRemove(median + 1, high, depth + 1, elt);
+
+    // The median element of a node lies in its left range, so is only ever removed via a path through the node
+    if (isFound && !m_isNodeRemoved[median] && KDTreeLinkerFlatAlgo::isSameElement(m_nodeInfos[median], elt))
+        m_isNodeRemoved[median] = true;
+
+    return isFound;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::addCandidate(const DistanceIndexPair &candidate, const unsigned k, DistanceIndexPairVector &heap)
+{
+    if (heap.size() < k)
+    {
+        heap.push_back(candidate);
+        std::push_heap(heap.begin(), heap.end());
+    }
+    else if (candidate < heap.front())
+    {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = candidate;
+        std::push_heap(heap.begin(), heap.end());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool KDTreeLinkerFlatAlgo<DATA, DIM>::isSameElement(const NodeInfo &a, const NodeInfo &b)
+{
+    return ((a.data == b.data) && (a.dims == b.dims));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline unsigned KDTreeLinkerFlatAlgo<DATA, DIM>::medianIndex(const unsigned low, const unsigned high)
+{
+    const unsigned nbrElts(high - low);
+    return low + nbrElts / 2 - (1 - (nbrElts & 1));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::medianSearch(const unsigned low, const unsigned high, const unsigned treeDepth)
+{
+    // ATTN Signed indices, as the partition bounds may step one below low
+    const int median(static_cast<int>(KDTreeLinkerFlatAlgo::medianIndex(low, high)));
+    const unsigned thedim(treeDepth % DIM);
+
+    int l(static_cast<int>(low));
+    int m(static_cast<int>(high) - 1);
+
+    while (l < m)
+    {
+        const float value(m_elements[median].dims[thedim]);
+        int i(l);
+        int j(m);
+
+        do
+        {
+            while (m_elements[i].dims[thedim] < value)
+                ++i;
+            while (m_elements[j].dims[thedim] > value)
+                --j;
+
+            if (i <= j)
+            {
+                std::swap(m_elements[i], m_elements[j]);
+                i++;
+                j--;
+            }
+        } while (i <= j);
+
+        if (j < median)
+            l = i;
+        if (i > median)
+            m = j;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::recBuild(const unsigned low, const unsigned high, const unsigned depth)
+{
+    if (high - low < 2)
+        return;
+
+    this->medianSearch(low, high, depth);
+
+    // ATTN The median element may subsequently be moved within the left range, so the node keeps its own copy
+    const unsigned median(KDTreeLinkerFlatAlgo::medianIndex(low, high));
+    m_nodeInfos[median] = m_elements[median];
+    m_splitValues[median] = m_elements[median].dims[depth % DIM];
+
+    this->recBuild(low, median + 1, depth + 1);
+    this->recBuild(median + 1, high, depth + 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::recSearch(const unsigned low, const unsigned high, const unsigned depth, const KDTreeBoxT<DIM> &region,
+    const KDTreeBoxT<DIM> &trackBox, NodeInfoList &result) const
+{
+    if (high - low == 1)
+    {
+        bool isInside(true);
+
+        for (unsigned i = 0; i < DIM; ++i)
+        {
+            const float thedim(m_coordinates[i][low]);
+            isInside = isInside && thedim >= trackBox.dimmin[i] && thedim <= trackBox.dimmax[i];
+        }
+
+        if (isInside && !m_isRemoved[low])
+            result.push_back(m_elements[low]);
+    }
+    else
+    {
+        const unsigned median(KDTreeLinkerFlatAlgo::medianIndex(low, high));
+        const unsigned thedim(depth % DIM);
+
+        KDTreeBoxT<DIM> leftRegion(region);
+        KDTreeBoxT<DIM> rightRegion(region);
+        leftRegion.dimmax[thedim] = m_splitValues[median];
+        rightRegion.dimmin[thedim] = m_splitValues[median];
+
+        this->searchChild(low, median + 1, depth + 1, leftRegion, trackBox, result);
+        this->searchChild(median + 1, high, depth + 1, rightRegion, trackBox, result);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::searchChild(const unsigned low, const unsigned high, const unsigned depth, const KDTreeBoxT<DIM> &region,
+    const KDTreeBoxT<DIM> &trackBox, NodeInfoList &result) const
+{
+    bool isFullyContained(true);
+    bool hasIntersection(true);
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        const float regionmin(region.dimmin[i]);
+        const float regionmax(region.dimmax[i]);
+        isFullyContained = isFullyContained && (regionmin >= trackBox.dimmin[i] && regionmax <= trackBox.dimmax[i]);
+        hasIntersection = hasIntersection && (regionmin < trackBox.dimmax[i] && regionmax > trackBox.dimmin[i]);
+    }
+
+    if (isFullyContained)
+    {
+        // A contained subtree occupies a contiguous range of the element list
+        if (0 == m_nRemoved)
+        {
+            result.insert(result.end(), m_elements.begin() + low, m_elements.begin() + high);
+        }
+        else
+        {
+            for (unsigned index = low; index < high; ++index)
+            {
+                if (!m_isRemoved[index])
+                    result.push_back(m_elements[index]);
+            }
+        }
+    }
+    else if (hasIntersection)
+    {
+        this->recSearch(low, high, depth, region, trackBox, result);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::recNearestNeighbour(
+    const unsigned low, const unsigned high, const unsigned depth, const NodeInfo &point, const NodeInfo *&pBestMatch, float &bestDist2) const
+{
+    if (high - low == 1)
+    {
+        pBestMatch = m_isRemoved[low] ? nullptr : &m_elements[low];
+        bestDist2 = m_isRemoved[low] ? std::numeric_limits<float>::max() : this->dist2(point, low);
+        return;
+    }
+
+    const unsigned median(KDTreeLinkerFlatAlgo::medianIndex(low, high));
+    const float distToAxis(point.dims[depth % DIM] - m_splitValues[median]);
+
+    if (distToAxis < 0.f)
+    {
+        this->recNearestNeighbour(low, median + 1, depth + 1, point, pBestMatch, bestDist2);
+    }
+    else
+    {
+        this->recNearestNeighbour(median + 1, high, depth + 1, point, pBestMatch, bestDist2);
+    }
+
+    if (!m_isNodeRemoved[median])
+    {
+        const NodeInfo &nodeInfo(m_nodeInfos[median]);
+        const float distCurrent(this->dist2(point, nodeInfo));
+
+        if (distCurrent < bestDist2)
+        {
+            bestDist2 = distCurrent;
+            pBestMatch = &nodeInfo;
+        }
+    }
+
+    // Now we see if the radius to best crosses the splitting axis
+    if (bestDist2 > distToAxis * distToAxis)
+    {
+        const NodeInfo *pCheckBest(pBestMatch);
+        float checkDist2(bestDist2);
+
+        if (distToAxis < 0.f)
+        {
+            this->recNearestNeighbour(median + 1, high, depth + 1, point, pCheckBest, checkDist2);
+        }
+        else
+        {
+            this->recNearestNeighbour(low, median + 1, depth + 1, point, pCheckBest, checkDist2);
+        }
+
+        if (checkDist2 < bestDist2)
+        {
+            bestDist2 = checkDist2;
+            pBestMatch = pCheckBest;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::recKNearestNeighbours(
+    const unsigned low, const unsigned high, const unsigned depth, const NodeInfo &point, const unsigned k, DistanceIndexPairVector &heap) const
+{
+    if (high - low == 1)
+    {
+        if (!m_isRemoved[low])
+            KDTreeLinkerFlatAlgo::addCandidate(DistanceIndexPair(this->dist2(point, low), low), k, heap);
+
+        return;
+    }
+
+    const unsigned median(KDTreeLinkerFlatAlgo::medianIndex(low, high));
+    const float distToAxis(point.dims[depth % DIM] - m_splitValues[median]);
+    const bool nearIsLeft(distToAxis < 0.f);
+
+    if (nearIsLeft)
+    {
+        this->recKNearestNeighbours(low, median + 1, depth + 1, point, k, heap);
+    }
+    else
+    {
+        this->recKNearestNeighbours(median + 1, high, depth + 1, point, k, heap);
+    }
+
+    // Elements on the far side of the splitting axis are at least the axis distance away
+    if ((heap.size() < k) || (distToAxis * distToAxis <= heap.front().first))
+    {
+        if (nearIsLeft)
+        {
+            this->recKNearestNeighbours(median + 1, high, depth + 1, point, k, heap);
+        }
+        else
+        {
+            this->recKNearestNeighbours(low, median + 1, depth + 1, point, k, heap);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerFlatAlgo<DATA, DIM>::recSearchRadius(
+    const unsigned low, const unsigned high, const unsigned depth, const NodeInfo &point, const float radius, NodeInfoList &result) const
+{
+    if (high - low == 1)
+    {
+        if (!m_isRemoved[low] && (this->dist2(point, low) <= radius * radius))
+            result.push_back(m_elements[low]);
+
+        return;
+    }
+
+    // Visit the left range before the right, so that the results are in tree order
+    const unsigned median(KDTreeLinkerFlatAlgo::medianIndex(low, high));
+    const unsigned thedim(depth % DIM);
+
+    if (point.dims[thedim] - radius <= m_splitValues[median])
+        this->recSearchRadius(low, median + 1, depth + 1, point, radius, result);
+
+    if (point.dims[thedim] + radius >= m_splitValues[median])
+        this->recSearchRadius(median + 1, high, depth + 1, point, radius, result);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline float KDTreeLinkerFlatAlgo<DATA, DIM>::dist2(const NodeInfo &point, const unsigned index) const
+{
+    double d = 0.;
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        const double diff = point.dims[i] - m_coordinates[i][index];
+        d += diff * diff;
+    }
+
+    return (float)d;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline float KDTreeLinkerFlatAlgo<DATA, DIM>::dist2(const NodeInfo &a, const NodeInfo &b) const
+{
+    double d = 0.;
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        const double diff = a.dims[i] - b.dims[i];
+        d += diff * diff;
+    }
+
+    return (float)d;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_KD_TREE_LINKER_FLAT_ALGO_TEMPLATED_H
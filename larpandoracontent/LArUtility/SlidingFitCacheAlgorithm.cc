@@ -0,0 +1,67 @@
+/**
+ *  @file   larpandoracontent/LArUtility/SlidingFitCacheAlgorithm.cc
+ *
+ *  @brief  Implementation of the sliding fit cache algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+
+#include "larpandoracontent/LArUtility/SlidingFitCacheAlgorithm.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+SlidingFitCacheAlgorithm::SlidingFitCacheAlgorithm() :
+    m_printStatistics(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SlidingFitCacheAlgorithm::~SlidingFitCacheAlgorithm()
+{
+    LArSlidingFitCacheHelper::DisableCache(this->GetPandora());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode SlidingFitCacheAlgorithm::Reset()
+{
+    if (m_printStatistics)
+    {
+        const LArSlidingFitCacheHelper::Statistics statistics(LArSlidingFitCacheHelper::GetStatistics(this->GetPandora()));
+
+        std::cout << "SlidingFitCacheAlgorithm: " << statistics.m_nHits << " hits, " << statistics.m_nMisses << " misses, "
+                  << statistics.m_nInvalidations << " invalidations" << std::endl;
+    }
+
+    LArSlidingFitCacheHelper::ResetCache(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode SlidingFitCacheAlgorithm::Run()
+{
+    // ATTN Clusters from a previous event may share addresses with those in this event, so never start an event with a populated cache
+    LArSlidingFitCacheHelper::ResetCache(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode SlidingFitCacheAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PrintStatistics", m_printStatistics));
+
+    LArSlidingFitCacheHelper::EnableCache(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,43 @@
+/**
+ *  @file   larpandoracontent/LArUtility/SlidingFitCacheAlgorithm.h
+ *
+ *  @brief  Header file for the sliding fit cache algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SLIDING_FIT_CACHE_ALGORITHM_H
+#define LAR_SLIDING_FIT_CACHE_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  SlidingFitCacheAlgorithm class. Enables the shared sliding fit cache for its pandora instance and clears the cache at the start and
+ *          end of each event. It should be placed ahead of any algorithms that make use of the cache.
+ */
+class SlidingFitCacheAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    SlidingFitCacheAlgorithm();
+
+    /**
+     *  @brief  Destructor, disabling the cache
+     */
+    ~SlidingFitCacheAlgorithm();
+
+private:
+    pandora::StatusCode Reset();
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    bool m_printStatistics; ///< Whether to print the cache hit and miss counts at the end of each event
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SLIDING_FIT_CACHE_ALGORITHM_H
@@ -9,6 +9,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
@@ -133,7 +134,9 @@ void VertexSelectionBaseAlgorithm::CalculateClusterSlidingFits(const ClusterList
         // Make sure the window size is such that there are not more layers than hits (following TwoDSlidingLinearFit calculation).
         const unsigned int newSlidingFitWindow(
             std::min(static_cast<int>(pCluster->GetNCaloHits()), static_cast<int>(slidingFitPitch * slidingFitWindow)));
-        slidingFitDataList.emplace_back(pCluster, newSlidingFitWindow, slidingFitPitch);
+        LArSlidingFitCacheHelper::TwoDSlidingFitResultPtr pUncachedFitResult;
+        slidingFitDataList.emplace_back(LArSlidingFitCacheHelper::GetTwoDSlidingFitResult(
+            this->GetPandora(), pCluster, newSlidingFitWindow, slidingFitPitch, pUncachedFitResult));
     }
 }
 
@@ -346,18 +349,13 @@ bool VertexSelectionBaseAlgorithm::SortByVertexZPosition(const pandora::Vertex *
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-VertexSelectionBaseAlgorithm::SlidingFitData::SlidingFitData(const pandora::Cluster *const pCluster, const int slidingFitWindow, const float slidingFitPitch) :
-    m_minLayerDirection(0.f, 0.f, 0.f),
-    m_maxLayerDirection(0.f, 0.f, 0.f),
-    m_minLayerPosition(0.f, 0.f, 0.f),
-    m_maxLayerPosition(0.f, 0.f, 0.f),
-    m_pCluster(pCluster)
+VertexSelectionBaseAlgorithm::SlidingFitData::SlidingFitData(const TwoDSlidingFitResult &slidingFitResult) :
+    m_minLayerDirection(slidingFitResult.GetGlobalMinLayerDirection()),
+    m_maxLayerDirection(slidingFitResult.GetGlobalMaxLayerDirection()),
+    m_minLayerPosition(slidingFitResult.GetGlobalMinLayerPosition()),
+    m_maxLayerPosition(slidingFitResult.GetGlobalMaxLayerPosition()),
+    m_pCluster(slidingFitResult.GetCluster())
 {
-    const TwoDSlidingFitResult slidingFitResult(pCluster, slidingFitWindow, slidingFitPitch);
-    m_minLayerDirection = slidingFitResult.GetGlobalMinLayerDirection();
-    m_maxLayerDirection = slidingFitResult.GetGlobalMaxLayerDirection();
-    m_minLayerPosition = slidingFitResult.GetGlobalMinLayerPosition();
-    m_maxLayerPosition = slidingFitResult.GetGlobalMaxLayerPosition();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -123,11 +123,9 @@ public:
         /**
          *  @brief  Constructor
          *
-         *  @param  pCluster pointer to the cluster
-         *  @param  slidingFitWindow the sliding fit window
-         *  @param  slidingFitPitch the sliding fit pitch
+         *  @param  slidingFitResult the sliding fit result for the cluster
          */
-        SlidingFitData(const pandora::Cluster *const pCluster, const int slidingFitWindow, const float slidingFitPitch);
+        explicit SlidingFitData(const TwoDSlidingFitResult &slidingFitResult);
 
         /**
          *  @brief  Get the min layer direction
@@ -33,6 +33,7 @@ DlHitTrackShowerIdAlgorithm::DlHitTrackShowerIdAlgorithm() :
     m_imageHeight(256),
     m_imageWidth(256),
     m_tileSize(128.f),
+    m_maxBatchSize(1),
     m_visualize(false),
     m_useTrainingMode(false),
     m_trainingOutputFile("")
@@ -170,124 +171,17 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
         this->GetSparseTileMap(*pCaloHitList, xMin, zMin, nTilesX, sparseMap);
         const int nTiles = sparseMap.size();
 
+        TileToCaloHitsVector tileToCaloHits;
+        this->GetTiledCaloHits(*pCaloHitList, xMin, zMin, nTilesX, sparseMap, tileToCaloHits);
+
+        // Process the populated tiles in batches, stacking each batch into a single network input
         CaloHitList trackHits, showerHits, otherHits;
-        // Process tile
-        // ATTN: Be sure to reset all values to zero after each tile has been processed
-        float **weights = new float *[m_imageHeight];
-        for (int r = 0; r < m_imageHeight; ++r)
-            weights[r] = new float[m_imageWidth]();
-        for (int i = 0; i < nTiles; ++i)
+        FloatVector weights(static_cast<size_t>(std::min(m_maxBatchSize, nTiles)) * m_imageHeight * m_imageWidth, 0.f);
+        for (int firstTile = 0; firstTile < nTiles; firstTile += m_maxBatchSize)
         {
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                const float x(pCaloHit->GetPositionVector().GetX());
-                const float z(pCaloHit->GetPositionVector().GetZ());
-                // Determine which tile the hit will be assigned to
-                const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
-                const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                {
-                    // Determine hit position within the tile
-                    const float localX = std::fmod(x - xMin, m_tileSize);
-                    const float localZ = std::fmod(z - zMin, m_tileSize);
-                    // Determine hit pixel within the tile
-                    const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
-                    const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
-                    weights[pixelZ][pixelX] += pCaloHit->GetInputEnergy();
-                }
-            }
-
-            // Find min and max charge to allow normalisation
-            float chargeMin{std::numeric_limits<float>::max()}, chargeMax{-std::numeric_limits<float>::max()};
-            for (int r = 0; r < m_imageHeight; ++r)
-            {
-                for (int c = 0; c < m_imageWidth; ++c)
-                {
-                    if (weights[r][c] > chargeMax)
-                        chargeMax = weights[r][c];
-                    if (weights[r][c] < chargeMin)
-                        chargeMin = weights[r][c];
-                }
-            }
-            float chargeRange{chargeMax - chargeMin};
-            if (chargeRange <= 0.f)
-                chargeRange = 1.f;
-
-            // Populate accessor based on normalised weights
-            CaloHitToPixelMap caloHitToPixelMap;
-            LArDLHelper::TorchInput input;
-            LArDLHelper::InitialiseInput({1, 1, m_imageHeight, m_imageWidth}, input);
-            auto accessor = input.accessor<float, 4>();
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                const float x(pCaloHit->GetPositionVector().GetX());
-                const float z(pCaloHit->GetPositionVector().GetZ());
-                // Determine which tile the hit will be assigned to
-                const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
-                const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                {
-                    // Determine hit position within the tile
-                    const float localX = std::fmod(x - xMin, m_tileSize);
-                    const float localZ = std::fmod(z - zMin, m_tileSize);
-                    // Determine hit pixel within the tile
-                    const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
-                    const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
-                    accessor[0][0][pixelZ][pixelX] = (weights[pixelZ][pixelX] - chargeMin) / chargeRange;
-                    caloHitToPixelMap.insert(std::make_pair(pCaloHit, std::make_tuple(tileZ, tileX, pixelZ, pixelX)));
-                }
-            }
-            // Reset weights
-            for (int r = 0; r < this->m_imageHeight; ++r)
-                for (int c = 0; c < this->m_imageWidth; ++c)
-                    weights[r][c] = 0.f;
-
-            // Run the input through the trained model and get the output accessor
-            LArDLHelper::TorchInputVector inputs;
-            inputs.push_back(input);
-            LArDLHelper::TorchOutput output;
-            LArDLHelper::Forward(model, inputs, output);
-            auto outputAccessor = output.accessor<float, 4>();
-
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                auto found{caloHitToPixelMap.find(pCaloHit)};
-                if (found == caloHitToPixelMap.end())
-                    continue;
-                auto pixelMap = found->second;
-                const int tileZ(std::get<0>(pixelMap));
-                const int tileX(std::get<1>(pixelMap));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                { // Make sure we're looking at a hit in the correct tile
-                    const int pixelZ(std::get<2>(pixelMap));
-                    const int pixelX(std::get<3>(pixelMap));
-
-                    // Apply softmax to loss to get actual probability
-                    float probShower = exp(outputAccessor[0][1][pixelZ][pixelX]);
-                    float probTrack = exp(outputAccessor[0][2][pixelZ][pixelX]);
-                    float probNull = exp(outputAccessor[0][0][pixelZ][pixelX]);
-                    if (probShower > probTrack && probShower > probNull)
-                        showerHits.push_back(pCaloHit);
-                    else if (probTrack > probShower && probTrack > probNull)
-                        trackHits.push_back(pCaloHit);
-                    else
-                        otherHits.push_back(pCaloHit);
-                    float recipSum = 1.f / (probShower + probTrack);
-                    // Adjust probabilities to ignore null hits and update LArCaloHit
-                    probShower *= recipSum;
-                    probTrack *= recipSum;
-                    LArCaloHit *pLArCaloHit{const_cast<LArCaloHit *>(dynamic_cast<const LArCaloHit *>(pCaloHit))};
-                    pLArCaloHit->SetShowerProbability(probShower);
-                    pLArCaloHit->SetTrackProbability(probTrack);
-                }
-            }
+            const int nBatchTiles{std::min(m_maxBatchSize, nTiles - firstTile)};
+            this->InferTileBatch(model, tileToCaloHits, firstTile, nBatchTiles, weights, trackHits, showerHits, otherHits);
         }
-        for (int r = 0; r < this->m_imageHeight; ++r)
-            delete[] weights[r];
-        delete[] weights;
 
         if (m_visualize)
         {
@@ -362,6 +256,110 @@ void DlHitTrackShowerIdAlgorithm::GetSparseTileMap(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void DlHitTrackShowerIdAlgorithm::GetTiledCaloHits(const CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX,
+    const PixelToTileMap &sparseMap, TileToCaloHitsVector &tileToCaloHits) const
+{
+    tileToCaloHits.resize(sparseMap.size());
+
+    for (const CaloHit *pCaloHit : caloHitList)
+    {
+        const float x(pCaloHit->GetPositionVector().GetX());
+        const float z(pCaloHit->GetPositionVector().GetZ());
+        // Determine which tile the hit will be assigned to
+        const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
+        const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
+        const int tile = sparseMap.at(tileZ * nTilesX + tileX);
+        // Determine hit position within the tile
+        const float localX = std::fmod(x - xMin, m_tileSize);
+        const float localZ = std::fmod(z - zMin, m_tileSize);
+        // Determine hit pixel within the tile
+        const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
+        const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
+        tileToCaloHits.at(tile).emplace_back(pCaloHit, pixelZ, pixelX);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DlHitTrackShowerIdAlgorithm::InferTileBatch(LArDLHelper::TorchModel &model, const TileToCaloHitsVector &tileToCaloHits, const int firstTile,
+    const int nBatchTiles, FloatVector &weights, CaloHitList &trackHits, CaloHitList &showerHits, CaloHitList &otherHits) const
+{
+    const size_t nPixels{static_cast<size_t>(m_imageHeight) * m_imageWidth};
+
+    LArDLHelper::TorchInput input;
+    LArDLHelper::InitialiseInput({nBatchTiles, 1, m_imageHeight, m_imageWidth}, input);
+    auto accessor = input.accessor<float, 4>();
+
+    for (int b = 0; b < nBatchTiles; ++b)
+    {
+        const TiledCaloHitVector &tiledCaloHits(tileToCaloHits.at(firstTile + b));
+        float *const pTileWeights{weights.data() + b * nPixels};
+
+        for (const TiledCaloHit &tiledCaloHit : tiledCaloHits)
+            pTileWeights[tiledCaloHit.m_pixelZ * m_imageWidth + tiledCaloHit.m_pixelX] += tiledCaloHit.m_pCaloHit->GetInputEnergy();
+
+        // Find min and max charge to allow normalisation
+        float chargeMin{std::numeric_limits<float>::max()}, chargeMax{-std::numeric_limits<float>::max()};
+        for (size_t p = 0; p < nPixels; ++p)
+        {
+            if (pTileWeights[p] > chargeMax)
+                chargeMax = pTileWeights[p];
+            if (pTileWeights[p] < chargeMin)
+                chargeMin = pTileWeights[p];
+        }
+        float chargeRange{chargeMax - chargeMin};
+        if (chargeRange <= 0.f)
+            chargeRange = 1.f;
+
+        // Populate accessor based on normalised weights
+        for (const TiledCaloHit &tiledCaloHit : tiledCaloHits)
+        {
+            const int pixelZ{tiledCaloHit.m_pixelZ}, pixelX{tiledCaloHit.m_pixelX};
+            accessor[b][0][pixelZ][pixelX] = (pTileWeights[pixelZ * m_imageWidth + pixelX] - chargeMin) / chargeRange;
+        }
+
+        // ATTN: Only the populated pixels need to be reset, as no others were touched
+        for (const TiledCaloHit &tiledCaloHit : tiledCaloHits)
+            pTileWeights[tiledCaloHit.m_pixelZ * m_imageWidth + tiledCaloHit.m_pixelX] = 0.f;
+    }
+
+    // Run the batch through the trained model and get the output accessor
+    LArDLHelper::TorchInputVector inputs;
+    inputs.push_back(input);
+    LArDLHelper::TorchOutput output;
+    LArDLHelper::Forward(model, inputs, output);
+    auto outputAccessor = output.accessor<float, 4>();
+
+    for (int b = 0; b < nBatchTiles; ++b)
+    {
+        for (const TiledCaloHit &tiledCaloHit : tileToCaloHits.at(firstTile + b))
+        {
+            const CaloHit *const pCaloHit{tiledCaloHit.m_pCaloHit};
+            const int pixelZ{tiledCaloHit.m_pixelZ}, pixelX{tiledCaloHit.m_pixelX};
+
+            // Apply softmax to loss to get actual probability
+            float probShower = exp(outputAccessor[b][1][pixelZ][pixelX]);
+            float probTrack = exp(outputAccessor[b][2][pixelZ][pixelX]);
+            float probNull = exp(outputAccessor[b][0][pixelZ][pixelX]);
+            if (probShower > probTrack && probShower > probNull)
+                showerHits.push_back(pCaloHit);
+            else if (probTrack > probShower && probTrack > probNull)
+                trackHits.push_back(pCaloHit);
+            else
+                otherHits.push_back(pCaloHit);
+            float recipSum = 1.f / (probShower + probTrack);
+            // Adjust probabilities to ignore null hits and update LArCaloHit
+            probShower *= recipSum;
+            probTrack *= recipSum;
+            LArCaloHit *pLArCaloHit{const_cast<LArCaloHit *>(dynamic_cast<const LArCaloHit *>(pCaloHit))};
+            pLArCaloHit->SetShowerProbability(probShower);
+            pLArCaloHit->SetTrackProbability(probTrack);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseTrainingMode", m_useTrainingMode));
@@ -414,6 +412,12 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         std::cout << "Error: Invalid image size specification" << std::endl;
         return STATUS_CODE_INVALID_PARAMETER;
     }
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxBatchSize", m_maxBatchSize));
+    if (m_maxBatchSize <= 0)
+    {
+        std::cout << "Error: Invalid maximum batch size" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Visualize", m_visualize));
 
     return STATUS_CODE_SUCCESS;
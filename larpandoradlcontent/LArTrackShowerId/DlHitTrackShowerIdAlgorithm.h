@@ -29,7 +29,28 @@ public:
     virtual ~DlHitTrackShowerIdAlgorithm();
 
 private:
-    typedef std::map<const pandora::CaloHit *, std::tuple<int, int, int, int>> CaloHitToPixelMap;
+    /**
+     *  @brief  A calo hit and the pixel, within its tile, to which it is assigned
+     */
+    class TiledCaloHit
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCaloHit the address of the calo hit
+         *  @param  pixelZ the pixel row within the tile
+         *  @param  pixelX the pixel column within the tile
+         */
+        TiledCaloHit(const pandora::CaloHit *const pCaloHit, const int pixelZ, const int pixelX);
+
+        const pandora::CaloHit *m_pCaloHit; ///< The address of the calo hit
+        int m_pixelZ;                       ///< The pixel row within the tile
+        int m_pixelX;                       ///< The pixel column within the tile
+    };
+
+    typedef std::vector<TiledCaloHit> TiledCaloHitVector;
+    typedef std::vector<TiledCaloHitVector> TileToCaloHitsVector;
     typedef std::map<int, int> PixelToTileMap;
 
     pandora::StatusCode Run();
@@ -67,6 +88,34 @@ private:
      */
     void GetSparseTileMap(const pandora::CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX, PixelToTileMap &sparseMap);
 
+    /**
+     *  @brief  Assign each calo hit to its populated tile and to its pixel within that tile, in a single pass over the hits
+     *
+     *  @param  caloHitList The list of CaloHits to be assigned
+     *  @param  xMin The minimum x-coordinate
+     *  @param  zMin The minimum z-coordinate
+     *  @param  nTilesX The number of tiles in the x direction
+     *  @param  sparseMap The map between pixels and populated tiles
+     *  @param  tileToCaloHits The output calo hits in each populated tile, in the order of the input list
+     */
+    void GetTiledCaloHits(const pandora::CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX,
+        const PixelToTileMap &sparseMap, TileToCaloHitsVector &tileToCaloHits) const;
+
+    /**
+     *  @brief  Run network inference over a batch of consecutive tiles, setting the track and shower probabilities of their calo hits
+     *
+     *  @param  model The model to run
+     *  @param  tileToCaloHits The calo hits in each populated tile
+     *  @param  firstTile The index of the first tile in the batch
+     *  @param  nBatchTiles The number of tiles in the batch
+     *  @param  weights The scratch pixel weights for each tile in the batch, all zero on input and on output
+     *  @param  trackHits The list to receive the calo hits identified as track-like
+     *  @param  showerHits The list to receive the calo hits identified as shower-like
+     *  @param  otherHits The list to receive the remaining calo hits
+     */
+    void InferTileBatch(LArDLHelper::TorchModel &model, const TileToCaloHitsVector &tileToCaloHits, const int firstTile, const int nBatchTiles,
+        pandora::FloatVector &weights, pandora::CaloHitList &trackHits, pandora::CaloHitList &showerHits, pandora::CaloHitList &otherHits) const;
+
     pandora::StringVector m_caloHitListNames; ///< Name of input calo hit list
     std::string m_modelFileNameU;             ///< Model file name for U view
     std::string m_modelFileNameV;             ///< Model file name for V view
@@ -77,11 +126,21 @@ private:
     int m_imageHeight;                        ///< Height of images in pixels
     int m_imageWidth;                         ///< Width of images in pixels
     float m_tileSize;                         ///< Size of tile in cm
+    int m_maxBatchSize;                       ///< Maximum number of tiles to stack in a single batch passed to the network
     bool m_visualize;                         ///< Whether to visualize the track shower ID scores
     bool m_useTrainingMode;                   ///< Training mode
     std::string m_trainingOutputFile;         ///< Output file name for training examples
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline DlHitTrackShowerIdAlgorithm::TiledCaloHit::TiledCaloHit(const pandora::CaloHit *const pCaloHit, const int pixelZ, const int pixelX) :
+    m_pCaloHit(pCaloHit),
+    m_pixelZ(pixelZ),
+    m_pixelX(pixelX)
+{
+}
+
 } // namespace lar_dl_content
 
 #endif // LAR_DL_HIT_TRACK_SHOWER_ID_ALGORITHM_H
@@ -184,22 +184,21 @@ StatusCode DlVertexingAlgorithm::Infer()
         else
             LArDLHelper::Forward(m_modelW, inputs, output);
 
+        IntVector classVector;
+        this->GetPixelClasses(output, pixelVector, classVector);
+
         int colOffset{0}, rowOffset{0}, canvasWidth{m_width}, canvasHeight{m_height};
-        this->GetCanvasParameters(output, pixelVector, colOffset, rowOffset, canvasWidth, canvasHeight);
+        this->GetCanvasParameters(pixelVector, classVector, colOffset, rowOffset, canvasWidth, canvasHeight);
 
         float **canvas{new float *[canvasHeight]};
         for (int row = 0; row < canvasHeight; ++row)
             canvas[row] = new float[canvasWidth]{};
 
-        // we want the maximum value in the num_classes dimension (1) for every pixel
-        auto classes{torch::argmax(output, 1)};
-        // the argmax result is a 1 x height x width tensor where each element is a class id
-        auto classesAccessor{classes.accessor<long, 3>()};
         const double scaleFactor{std::sqrt(m_height * m_height + m_width * m_width)};
-        std::map<int, bool> haveSeenMap;
-        for (const auto [row, col] : pixelVector)
+        for (size_t i = 0; i < pixelVector.size(); ++i)
         {
-            const auto cls{classesAccessor[0][row][col]};
+            const auto [row, col] = pixelVector[i];
+            const int cls{classVector[i]};
             if (cls > 0 && cls < m_nClasses)
             {
                 const int inner{static_cast<int>(std::round(std::ceil(scaleFactor * m_thresholds[cls - 1])))};
@@ -341,6 +340,9 @@ StatusCode DlVertexingAlgorithm::MakeNetworkInputFromHits(
     LArDLHelper::InitialiseInput({1, 1, m_height, m_width}, networkInput);
     auto accessor = networkInput.accessor<float, 4>();
 
+    // ATTN: Only the pixels containing hits are visited, the remainder of the input being left at its initial value of zero
+    PixelVector occupiedPixels;
+    occupiedPixels.reserve(caloHits.size());
     float maxValue{0.f};
     for (const CaloHit *pCaloHit : caloHits)
     {
@@ -357,18 +359,19 @@ StatusCode DlVertexingAlgorithm::MakeNetworkInputFromHits(
         accessor[0][0][pixelZ][pixelX] += adc;
         if (accessor[0][0][pixelZ][pixelX] > maxValue)
             maxValue = accessor[0][0][pixelZ][pixelX];
+        occupiedPixels.emplace_back(std::make_pair(pixelZ, pixelX));
     }
     if (maxValue > 0)
     {
-        for (int row = 0; row < m_height; ++row)
+        // Visit each occupied pixel once, in row-major order, to match the ordering of a scan over the full image
+        std::sort(occupiedPixels.begin(), occupiedPixels.end());
+        occupiedPixels.erase(std::unique(occupiedPixels.begin(), occupiedPixels.end()), occupiedPixels.end());
+        for (const auto [row, col] : occupiedPixels)
         {
-            for (int col = 0; col < m_width; ++col)
-            {
-                const float value{accessor[0][0][row][col]};
-                accessor[0][0][row][col] = value / maxValue;
-                if (value > 0)
-                    pixelVector.emplace_back(std::make_pair(row, col));
-            }
+            const float value{accessor[0][0][row][col]};
+            accessor[0][0][row][col] = value / maxValue;
+            if (value > 0)
+                pixelVector.emplace_back(std::make_pair(row, col));
         }
     }
 
@@ -443,20 +446,42 @@ StatusCode DlVertexingAlgorithm::MakeWirePlaneCoordinatesFromCanvas(const CaloHi
 
 //-----------------------------------------------------------------------------------------------------------------------------------------
 
-void DlVertexingAlgorithm::GetCanvasParameters(const LArDLHelper::TorchOutput &networkOutput, const PixelVector &pixelVector,
-    int &colOffset, int &rowOffset, int &width, int &height) const
+void DlVertexingAlgorithm::GetPixelClasses(const LArDLHelper::TorchOutput &networkOutput, const PixelVector &pixelVector, IntVector &classVector) const
 {
-    const double scaleFactor{std::sqrt(m_height * m_height + m_width * m_width)};
     // output is a 1 x num_classes x height x width tensor
-    // we want the maximum value in the num_classes dimension (1) for every pixel
-    auto classes{torch::argmax(networkOutput, 1)};
-    // the argmax result is a 1 x height x width tensor where each element is a class id
-    auto classesAccessor{classes.accessor<long, 3>()};
-    int colOffsetMin{0}, colOffsetMax{0}, rowOffsetMin{0}, rowOffsetMax{0};
+    // we want the maximum value in the num_classes dimension (1), but only for the populated pixels
+    auto outputAccessor{networkOutput.accessor<float, 4>()};
+    const int nClasses{static_cast<int>(networkOutput.size(1))};
+    classVector.reserve(pixelVector.size());
     for (const auto [row, col] : pixelVector)
     {
-        const auto cls{classesAccessor[0][row][col]};
-        const double threshold{m_thresholds[cls]};
+        // ATTN: Strict comparison, so ties resolve to the lowest class id, as for torch::argmax
+        int bestClass{0};
+        float bestValue{outputAccessor[0][0][row][col]};
+        for (int cls = 1; cls < nClasses; ++cls)
+        {
+            const float value{outputAccessor[0][cls][row][col]};
+            if (value > bestValue)
+            {
+                bestValue = value;
+                bestClass = cls;
+            }
+        }
+        classVector.emplace_back(bestClass);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------------
+
+void DlVertexingAlgorithm::GetCanvasParameters(
+    const PixelVector &pixelVector, const IntVector &classVector, int &colOffset, int &rowOffset, int &width, int &height) const
+{
+    const double scaleFactor{std::sqrt(m_height * m_height + m_width * m_width)};
+    int colOffsetMin{0}, colOffsetMax{0}, rowOffsetMin{0}, rowOffsetMax{0};
+    for (size_t i = 0; i < pixelVector.size(); ++i)
+    {
+        const auto [row, col] = pixelVector[i];
+        const double threshold{m_thresholds[classVector[i]]};
         if (threshold > 0. && threshold < 1.)
         {
             const int distance = static_cast<int>(std::round(std::ceil(scaleFactor * threshold)));
@@ -103,21 +103,31 @@ private:
     pandora::StatusCode MakeWirePlaneCoordinatesFromCanvas(const pandora::CaloHitList &caloHits, float **canvas, const int canvasWidth,
         const int canvasHeight, const int columnOffset, const int rowOffset, pandora::CartesianPointVector &positionVector) const;
 
+    /**
+     *  @brief  Determine the class predicted by the network for each populated pixel, i.e. the class with the largest output value.
+     *          Only the populated pixels are considered, avoiding an argmax over the full image.
+     *
+     *  @param  networkOutput The TorchOutput object populated by the network inference step
+     *  @param  pixelVector The vector of populated pixels
+     *  @param  classVector The output vector of class ids, one per populated pixel
+     */
+    void GetPixelClasses(const LArDLHelper::TorchOutput &networkOutput, const PixelVector &pixelVector, pandora::IntVector &classVector) const;
+
     /**
      *  @brief  Determines the parameters of the canvas for extracting the vertex location.
      *          The network predicts the distance that each pixel associated with a hit is located from the vertex, but says nothing about
      *          the direction. As a result, the ring describing the potential vertices associated with that hit can extend beyond the
      *          original canvas size. This function returns the size of the required canvas and the offset for the bottom left corner.
      *
-     *  @param  networkOutput The TorchOutput object populated by the network inference step
      *  @param  pixelVector The vector of populated pixels
+     *  @param  classVector The vector of class ids predicted for the populated pixels
      *  @param  columnOffset The output column offset for the canvas
      *  @param  rowOffset The output row offset for the canvas
      *  @param  width The output width for the canvas
      *  @param  height The output height for the canvas
      */
-    void GetCanvasParameters(const LArDLHelper::TorchOutput &networkOutput, const PixelVector &pixelVector, int &columnOffset,
-        int &rowOffset, int &width, int &height) const;
+    void GetCanvasParameters(const PixelVector &pixelVector, const pandora::IntVector &classVector, int &columnOffset, int &rowOffset,
+        int &width, int &height) const;
 
     /**
      *  @brief  Add a filled ring to the specified canvas.
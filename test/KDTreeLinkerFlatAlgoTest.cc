@@ -0,0 +1,277 @@
+/**
+ *  @file   test/KDTreeLinkerFlatAlgoTest.cc
+ *
+ *  @brief  Regression test for the flat kd tree. A fresh build must match KDTreeLinkerAlgo exactly. After any sequence of incremental
+ *          insertions and removals, whether or not they trigger a rebuild, every query must return the same elements, and the same
+ *          neighbour distances, as a tree freshly built from the remaining elements.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+#include "larpandoracontent/LArUtility/KDTreeLinkerFlatAlgoT.h"
+
+#include "test/LArTestHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace lar_content;
+
+namespace lar_test
+{
+
+typedef KDTreeLinkerFlatAlgo<unsigned, 2> FlatTree;
+typedef KDTreeLinkerAlgo<unsigned, 2> LinkedTree;
+typedef KDTreeNodeInfoT<unsigned, 2> Node;
+typedef std::vector<Node> NodeList;
+
+/**
+ *  @brief  Get the bounding region of a list of elements, as given by fill_and_bound_2d_kd_tree
+ *
+ *  @param  nodeList the elements
+ *
+ *  @return the bounding region
+ */
+KDTreeBox GetBoundingRegion(const NodeList &nodeList)
+{
+    KDTreeBox region(0.f, 0.f, 0.f, 0.f);
+
+    for (unsigned i = 0; i < 2; ++i)
+    {
+        region.dimmin[i] = nodeList.empty() ? 0.f : nodeList.front().dims[i];
+        region.dimmax[i] = region.dimmin[i];
+
+        for (const Node &node : nodeList)
+        {
+            region.dimmin[i] = std::min(region.dimmin[i], node.dims[i]);
+            region.dimmax[i] = std::max(region.dimmax[i], node.dims[i]);
+        }
+    }
+
+    return region;
+}
+
+/**
+ *  @brief  Whether two lists of elements are identical, in data, coordinates and order
+ *
+ *  @param  lhs the first list
+ *  @param  rhs the second list
+ *
+ *  @return boolean
+ */
+bool AreIdentical(const NodeList &lhs, const NodeList &rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+
+    for (unsigned index = 0; index < lhs.size(); ++index)
+    {
+        if ((lhs.at(index).data != rhs.at(index).data) || (lhs.at(index).dims != rhs.at(index).dims))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ *  @brief  Whether two lists of elements hold the same elements, in data and coordinates, in any order
+ *
+ *  @param  lhs the first list
+ *  @param  rhs the second list
+ *
+ *  @return boolean
+ */
+bool AreSameElements(NodeList lhs, NodeList rhs)
+{
+    const auto sortByData = [](const Node &a, const Node &b) { return (a.data < b.data); };
+    std::sort(lhs.begin(), lhs.end(), sortByData);
+    std::sort(rhs.begin(), rhs.end(), sortByData);
+
+    return AreIdentical(lhs, rhs);
+}
+
+/**
+ *  @brief  Whether an element is held by a tree, at a given distance from a point
+ *
+ *  @param  referenceTree the tree
+ *  @param  point the point
+ *  @param  node the element
+ *  @param  distance the distance, calculated as by the tree
+ *
+ *  @return boolean
+ */
+bool IsHeldAtDistance(const FlatTree &referenceTree, const Node &point, const Node &node, const float distance)
+{
+    double d(0.);
+
+    for (unsigned i = 0; i < 2; ++i)
+        d += (point.dims[i] - node.dims[i]) * static_cast<double>(point.dims[i] - node.dims[i]);
+
+    NodeList found;
+    referenceTree.searchRadius(node, 0.f, found);
+
+    return ((std::sqrt(static_cast<float>(d)) == distance) &&
+        (found.end() != std::find_if(found.begin(), found.end(), [&](const Node &candidate) { return (candidate.data == node.data); })));
+}
+
+/**
+ *  @brief  Compare the results of a set of queries on two trees, which should hold the same elements
+ *
+ *  @param  tree the tree under test
+ *  @param  referenceTree the freshly built reference tree
+ *  @param  generator the random number generator for the query points
+ *  @param  result the test result
+ */
+void CompareQueries(const FlatTree &tree, const FlatTree &referenceTree, std::mt19937 &generator, TestResult &result)
+{
+    std::uniform_real_distribution<float> position(-10.f, 110.f);
+    std::uniform_real_distribution<float> span(0.f, 15.f);
+
+    LAR_TEST_CHECK(result, tree.size() == referenceTree.size());
+    LAR_TEST_CHECK(result, tree.empty() == referenceTree.empty());
+
+    for (unsigned iQuery = 0; iQuery < 20; ++iQuery)
+    {
+        const Node point(0u, position(generator), position(generator));
+        const float halfWidth(span(generator));
+        const KDTreeBox searchBox(point.dims[0] - halfWidth, point.dims[0] + halfWidth, point.dims[1] - halfWidth, point.dims[1] + halfWidth);
+
+        NodeList found, referenceFound;
+        tree.search(searchBox, found);
+        referenceTree.search(searchBox, referenceFound);
+        LAR_TEST_CHECK(result, AreSameElements(found, referenceFound));
+
+        NodeList inRadius, referenceInRadius;
+        tree.searchRadius(point, halfWidth, inRadius);
+        referenceTree.searchRadius(point, halfWidth, referenceInRadius);
+        LAR_TEST_CHECK(result, AreSameElements(inRadius, referenceInRadius));
+
+        // ATTN Equidistant neighbours may be chosen differently, so compare the distances and check each neighbour is at its distance
+        NodeList nearest, referenceNearest;
+        std::vector<float> distances, referenceDistances;
+        tree.findKNearestNeighbours(point, 5, nearest, distances);
+        referenceTree.findKNearestNeighbours(point, 5, referenceNearest, referenceDistances);
+        LAR_TEST_CHECK(result, (nearest.size() == distances.size()) && (distances == referenceDistances));
+
+        for (unsigned index = 0; index < std::min(nearest.size(), distances.size()); ++index)
+            LAR_TEST_CHECK(result, IsHeldAtDistance(referenceTree, point, nearest.at(index), distances.at(index)));
+
+        const Node *pNearest(nullptr), *pReferenceNearest(nullptr);
+        float distance(0.f), referenceDistance(0.f);
+        tree.findNearestNeighbour(point, pNearest, distance);
+        referenceTree.findNearestNeighbour(point, pReferenceNearest, referenceDistance);
+        LAR_TEST_CHECK(result, (!pNearest && !pReferenceNearest) || (pNearest && pReferenceNearest));
+        LAR_TEST_CHECK(result, distance == referenceDistance);
+
+        if (pNearest)
+            LAR_TEST_CHECK(result, IsHeldAtDistance(referenceTree, point, *pNearest, distance));
+    }
+}
+
+} // namespace lar_test
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    using namespace lar_test;
+
+    TestResult result;
+    std::mt19937 generator(12345);
+
+    // ATTN Coordinates on a coarse grid, so that ties in the split values and on the search box edges are common
+    std::uniform_int_distribution<int> grid(0, 100);
+
+    for (unsigned iTrial = 0; iTrial < 20; ++iTrial)
+    {
+        NodeList nodeList;
+        unsigned nextData(0);
+
+        for (unsigned iNode = 0; iNode < 50 + 10 * iTrial; ++iNode)
+            nodeList.emplace_back(nextData++, static_cast<float>(grid(generator)), static_cast<float>(grid(generator)));
+
+        FlatTree tree;
+        tree.build(nodeList, GetBoundingRegion(nodeList));
+
+        // ATTN Cycle between the default thresholds, a rebuild on every change and no rebuild at all
+        if (1 == iTrial % 3)
+        {
+            tree.setRebuildThresholds(0.f, 0);
+        }
+        else if (2 == iTrial % 3)
+        {
+            tree.setRebuildThresholds(1.e6f, 1000000);
+        }
+
+        // A fresh flat tree must match the linked tree, in both box search order and nearest neighbour choice
+        NodeList linkedNodeList(nodeList);
+        LinkedTree linkedTree;
+        linkedTree.build(linkedNodeList, GetBoundingRegion(nodeList));
+
+        for (unsigned iQuery = 0; iQuery < 20; ++iQuery)
+        {
+            const Node point(0u, static_cast<float>(grid(generator)), static_cast<float>(grid(generator)));
+            const KDTreeBox searchBox(point.dims[0] - 7.f, point.dims[0] + 7.f, point.dims[1] - 7.f, point.dims[1] + 7.f);
+
+            NodeList found, linkedFound;
+            tree.search(searchBox, found);
+            linkedTree.search(searchBox, linkedFound);
+            LAR_TEST_CHECK(result, AreIdentical(found, linkedFound));
+
+            const Node *pNearest(nullptr), *pLinkedNearest(nullptr);
+            float distance(0.f), linkedDistance(0.f);
+            tree.findNearestNeighbour(point, pNearest, distance);
+            linkedTree.findNearestNeighbour(point, pLinkedNearest, linkedDistance);
+            LAR_TEST_CHECK(result, pNearest && pLinkedNearest && (pNearest->data == pLinkedNearest->data) && (distance == linkedDistance));
+        }
+
+        // Apply random batches of insertions and removals, comparing against a fresh build after each
+        for (unsigned iChange = 0; iChange < 30; ++iChange)
+        {
+            NodeList toRemove, toInsert;
+            std::uniform_int_distribution<unsigned> nChanges(0, 8);
+
+            for (unsigned iRemove = nChanges(generator); (iRemove > 0) && !nodeList.empty(); --iRemove)
+            {
+                const unsigned index(std::uniform_int_distribution<unsigned>(0, nodeList.size() - 1)(generator));
+                toRemove.push_back(nodeList.at(index));
+                nodeList.erase(nodeList.begin() + index);
+            }
+
+            for (unsigned iInsert = nChanges(generator); iInsert > 0; --iInsert)
+                toInsert.emplace_back(nextData++, static_cast<float>(grid(generator)), static_cast<float>(grid(generator)));
+
+            if (1 == toRemove.size())
+            {
+                LAR_TEST_CHECK(result, tree.remove(toRemove.front()));
+            }
+            else
+            {
+                LAR_TEST_CHECK(result, tree.remove(toRemove) == toRemove.size());
+            }
+
+            if (1 == toInsert.size())
+            {
+                tree.insert(toInsert.front());
+            }
+            else
+            {
+                tree.insert(toInsert);
+            }
+
+            nodeList.insert(nodeList.end(), toInsert.begin(), toInsert.end());
+
+            // Removing an element that is no longer present changes nothing
+            if (!toRemove.empty())
+                LAR_TEST_CHECK(result, !tree.remove(toRemove.front()));
+
+            FlatTree referenceTree;
+            referenceTree.build(nodeList, GetBoundingRegion(nodeList));
+            CompareQueries(tree, referenceTree, generator, result);
+        }
+    }
+
+    return result.Finish("KDTreeLinkerFlatAlgoTest");
+}
@@ -0,0 +1,234 @@
+/**
+ *  @file   test/LArDiscreteProbabilityHelperTest.cc
+ *
+ *  @brief  Regression test for the permutation test in the discrete probability helper. The p-values and the final random number
+ *          generator state must match those of the reference formulation, which draws two new randomised samples per permutation,
+ *          the second dataset before the first. Runs that stop early, including part way through a block of permutations, must
+ *          match a reference that tests each permutation in turn.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArHelpers/LArDiscreteProbabilityHelper.h"
+
+#include "test/LArTestHelper.h"
+
+#include <limits>
+
+using namespace lar_content;
+
+namespace lar_test
+{
+
+/**
+ *  @brief  Make a randomised sample of a dataset, as in the reference formulation
+ *
+ *  @param  t the dataset
+ *  @param  randomNumberGenerator the random number generator
+ *
+ *  @return the randomised sample
+ */
+pandora::FloatVector MakeRandomisedSample(const pandora::FloatVector &t, std::mt19937 &randomNumberGenerator)
+{
+    pandora::FloatVector randomisedVector(t);
+    std::shuffle(randomisedVector.begin(), randomisedVector.end(), randomNumberGenerator);
+
+    return randomisedVector;
+}
+
+/**
+ *  @brief  Make a randomised sample of a dataset, as in the reference formulation
+ *
+ *  @param  t the dataset
+ *  @param  randomNumberGenerator the random number generator
+ *
+ *  @return the randomised sample
+ */
+DiscreteProbabilityVector MakeRandomisedSample(const DiscreteProbabilityVector &t, std::mt19937 &randomNumberGenerator)
+{
+    return DiscreteProbabilityVector(t, randomNumberGenerator);
+}
+
+/**
+ *  @brief  Reference permutation test, testing each permutation in turn and stopping early if a decision function is provided
+ *
+ *  @param  t1 the first input dataset
+ *  @param  t2 the second input dataset
+ *  @param  randomNumberGenerator the random number generator
+ *  @param  nPermutations the (maximum) number of permutations
+ *  @param  pDecisionFunction address of the decision made on the p-value, used to stop early, or nullptr to run all permutations
+ *  @param  shuffleSecondFirst whether to draw the second randomised sample before the first, which is the documented order
+ *  @param  nUsedPermutations to receive the number of permutations run
+ *
+ *  @return the p-value
+ */
+template <typename T>
+float ReferencePValue(const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations,
+    const LArDiscreteProbabilityHelper::PValueDecisionFunction *const pDecisionFunction, const bool shuffleSecondFirst,
+    unsigned int &nUsedPermutations)
+{
+    const float rNominal(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(t1, t2));
+
+    unsigned int nExtreme(0);
+    for (unsigned int iPermutation = 0; iPermutation < nPermutations; ++iPermutation)
+    {
+        T randomised1(t1), randomised2(t2);
+
+        if (shuffleSecondFirst)
+        {
+            randomised2 = MakeRandomisedSample(t2, randomNumberGenerator);
+            randomised1 = MakeRandomisedSample(t1, randomNumberGenerator);
+        }
+        else
+        {
+            randomised1 = MakeRandomisedSample(t1, randomNumberGenerator);
+            randomised2 = MakeRandomisedSample(t2, randomNumberGenerator);
+        }
+
+        const float rRandomised(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(randomised1, randomised2));
+
+        if ((rRandomised - rNominal) > std::numeric_limits<float>::epsilon())
+            nExtreme++;
+
+        if (pDecisionFunction)
+        {
+            const unsigned int nRemaining(nPermutations - (iPermutation + 1));
+            const float minPValue(static_cast<float>(nExtreme) / static_cast<float>(nPermutations));
+            const float maxPValue(static_cast<float>(nExtreme + nRemaining) / static_cast<float>(nPermutations));
+
+            if ((nRemaining > 0) && ((*pDecisionFunction)(minPValue) == (*pDecisionFunction)(maxPValue)))
+            {
+                nUsedPermutations = iPermutation + 1;
+                return minPValue;
+            }
+        }
+    }
+
+    nUsedPermutations = nPermutations;
+    return static_cast<float>(nExtreme) / static_cast<float>(nPermutations);
+}
+
+/**
+ *  @brief  Reference permutation test, running all permutations in the documented order
+ *
+ *  @param  t1 the first input dataset
+ *  @param  t2 the second input dataset
+ *  @param  randomNumberGenerator the random number generator
+ *  @param  nPermutations the number of permutations
+ *
+ *  @return the p-value
+ */
+template <typename T>
+float ReferencePValue(const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations)
+{
+    unsigned int nUsedPermutations(0);
+    return ReferencePValue(t1, t2, randomNumberGenerator, nPermutations, nullptr, true, nUsedPermutations);
+}
+
+/**
+ *  @brief  Make a pair of partially correlated datasets
+ *
+ *  @param  seed the seed for the datasets
+ *  @param  size the dataset size
+ *  @param  values1 to receive the first dataset
+ *  @param  values2 to receive the second dataset
+ */
+void MakeDatasets(const unsigned int seed, const unsigned int size, pandora::FloatVector &values1, pandora::FloatVector &values2)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(0.f, 1.f);
+
+    values1.clear();
+    values2.clear();
+
+    for (unsigned int iElement = 0; iElement < size; ++iElement)
+        values1.push_back(distribution(generator));
+
+    for (unsigned int iElement = 0; iElement < size; ++iElement)
+        values2.push_back(0.5f * values1.at(iElement) + distribution(generator));
+}
+
+} // namespace lar_test
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    using namespace lar_test;
+
+    TestResult result;
+    unsigned int nOrderSensitive(0), nMidBlockStops(0);
+
+    for (unsigned int seed = 0; seed < 200; ++seed)
+    {
+        // ATTN Sizes and permutation counts chosen to exercise full and partial blocks of permutations
+        const unsigned int size(3 + seed % 20);
+        const unsigned int nPermutations(1 + (seed * 7) % 150);
+
+        pandora::FloatVector values1, values2;
+        MakeDatasets(seed, size, values1, values2);
+
+        std::mt19937 referenceGenerator(seed), generator(seed);
+        const float referencePValue(ReferencePValue(values1, values2, referenceGenerator, nPermutations));
+        const float pValue(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+            values1, values2, generator, nPermutations));
+
+        LAR_TEST_CHECK(result, referencePValue == pValue);
+        LAR_TEST_CHECK(result, referenceGenerator == generator);
+
+        // ATTN Count the runs whose p-value would differ were the first dataset shuffled first, to show that the checks pin the order
+        unsigned int nSwappedPermutations(0);
+        std::mt19937 swappedGenerator(seed);
+        if (ReferencePValue(values1, values2, swappedGenerator, nPermutations, nullptr, false, nSwappedPermutations) != pValue)
+            nOrderSensitive++;
+
+        DiscreteProbabilityVector::InputData<float, float> inputData1, inputData2;
+        for (unsigned int iElement = 0; iElement < size; ++iElement)
+        {
+            inputData1.emplace_back(static_cast<float>(iElement), values1.at(iElement));
+            inputData2.emplace_back(static_cast<float>(iElement), values2.at(iElement));
+        }
+
+        const DiscreteProbabilityVector vector1(inputData1, static_cast<float>(size), false);
+        const DiscreteProbabilityVector vector2(inputData2, static_cast<float>(size), false);
+
+        std::mt19937 referenceVectorGenerator(seed), vectorGenerator(seed);
+        const float referenceVectorPValue(ReferencePValue(vector1, vector2, referenceVectorGenerator, nPermutations));
+        const float vectorPValue(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+            vector1, vector2, vectorGenerator, nPermutations));
+
+        LAR_TEST_CHECK(result, referenceVectorPValue == vectorPValue);
+        LAR_TEST_CHECK(result, referenceVectorGenerator == vectorGenerator);
+
+        for (const float threshold : {0.5f, 0.9f, 0.99f})
+        {
+            const LArDiscreteProbabilityHelper::PValueDecisionFunction isMatched = [threshold](const float localPValue) {
+                return ((1.f - localPValue) - threshold > std::numeric_limits<float>::epsilon());
+            };
+
+            std::mt19937 fullGenerator(seed), earlyGenerator(seed), referenceEarlyGenerator(seed);
+            const float fullPValue(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+                values1, values2, fullGenerator, nPermutations));
+            const float earlyPValue(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+                values1, values2, earlyGenerator, nPermutations, isMatched));
+
+            LAR_TEST_CHECK(result, isMatched(fullPValue) == isMatched(earlyPValue));
+
+            // A run that stops part way through a block must leave the generator as if only the permutations run had been drawn
+            unsigned int nUsedPermutations(0);
+            const float referenceEarlyPValue(
+                ReferencePValue(values1, values2, referenceEarlyGenerator, nPermutations, &isMatched, true, nUsedPermutations));
+
+            LAR_TEST_CHECK(result, referenceEarlyPValue == earlyPValue);
+            LAR_TEST_CHECK(result, referenceEarlyGenerator == earlyGenerator);
+
+            if ((nUsedPermutations < nPermutations) && (0 != nUsedPermutations % 8))
+                nMidBlockStops++;
+        }
+    }
+
+    LAR_TEST_CHECK(result, nOrderSensitive > 0);
+    LAR_TEST_CHECK(result, nMidBlockStops > 0);
+
+    return result.Finish("LArDiscreteProbabilityHelperTest");
+}
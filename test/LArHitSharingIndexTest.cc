@@ -0,0 +1,198 @@
+/**
+ *  @file   test/LArHitSharingIndexTest.cc
+ *
+ *  @brief  Regression test for the hit sharing index. The shared hit counts, and hence the hierarchy matches, must be exactly those given by
+ *          intersecting the hit list with the hit list of every key in turn. The shared hits, and hence the pfo and mc particle hit sharing
+ *          maps, must be exactly those given by searching the hit list of every key for each hit.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArObjects/LArHitSharingIndex.h"
+
+#include "test/LArTestHelper.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <random>
+
+using namespace lar_content;
+
+namespace lar_test
+{
+
+typedef std::vector<unsigned int> HitList;
+typedef std::vector<HitList> HitListVector;
+typedef HitSharingIndex<unsigned int, unsigned int> Index;
+typedef std::map<unsigned int, unsigned int> KeyIndexToCountMap;
+typedef std::map<unsigned int, HitList> KeyIndexToHitListMap;
+
+/**
+ *  @brief  Make a sorted hit list, in which hits may be repeated
+ *
+ *  @param  nHits the number of hits
+ *  @param  maxHit the largest hit
+ *  @param  generator the random number generator
+ *
+ *  @return the hit list
+ */
+HitList MakeHitList(const unsigned int nHits, const unsigned int maxHit, std::mt19937 &generator)
+{
+    std::uniform_int_distribution<unsigned int> hit(0, maxHit);
+    HitList hitList;
+
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+        hitList.push_back(hit(generator));
+
+    std::sort(hitList.begin(), hitList.end());
+    return hitList;
+}
+
+/**
+ *  @brief  Get the best matched key for a hit list, by intersection with the hit list of every key, as in the original hierarchy matching
+ *
+ *  @param  keyHitLists the hit lists of the keys, in order of key index
+ *  @param  hitList the hit list
+ *  @param  keyIndexToCountMap to receive the non-zero shared hit count for each key index
+ *
+ *  @return the best matched key index, or the number of keys if there is no match
+ */
+unsigned int GetReferenceMatch(const HitListVector &keyHitLists, const HitList &hitList, KeyIndexToCountMap &keyIndexToCountMap)
+{
+    unsigned int bestKeyIndex(keyHitLists.size()), bestSharedHits(0);
+
+    for (unsigned int keyIndex = 0; keyIndex < keyHitLists.size(); ++keyIndex)
+    {
+        HitList intersection;
+        std::set_intersection(keyHitLists.at(keyIndex).begin(), keyHitLists.at(keyIndex).end(), hitList.begin(), hitList.end(),
+            std::back_inserter(intersection));
+
+        if (intersection.empty())
+            continue;
+
+        keyIndexToCountMap[keyIndex] = intersection.size();
+
+        if (intersection.size() > bestSharedHits)
+        {
+            bestSharedHits = intersection.size();
+            bestKeyIndex = keyIndex;
+        }
+    }
+
+    return bestKeyIndex;
+}
+
+/**
+ *  @brief  Get the hits shared with the hit list of every key, by searching the hit list of each key for each hit, as in GetSharedHits
+ *
+ *  @param  keyHitLists the hit lists of the keys, in order of key index
+ *  @param  hitList the hit list
+ *  @param  keyIndexToHitListMap to receive the non-empty list of shared hits for each key index
+ */
+void GetReferenceSharedHits(const HitListVector &keyHitLists, const HitList &hitList, KeyIndexToHitListMap &keyIndexToHitListMap)
+{
+    for (unsigned int keyIndex = 0; keyIndex < keyHitLists.size(); ++keyIndex)
+    {
+        const HitList &keyHitList(keyHitLists.at(keyIndex));
+
+        for (const unsigned int hit : hitList)
+        {
+            if (keyHitList.end() != std::find(keyHitList.begin(), keyHitList.end(), hit))
+                keyIndexToHitListMap[keyIndex].push_back(hit);
+        }
+    }
+}
+
+} // namespace lar_test
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    using namespace lar_test;
+
+    TestResult result;
+    std::mt19937 generator(12345);
+
+    for (unsigned int iTrial = 0; iTrial < 50; ++iTrial)
+    {
+        // ATTN Few distinct hits, so that repeated hits and ties in the shared hit counts are common
+        const unsigned int maxHit(10 + 5 * (iTrial % 10));
+        std::uniform_int_distribution<unsigned int> nHits(0, 30);
+
+        HitListVector keyHitLists;
+        Index index;
+
+        for (unsigned int keyIndex = 0; keyIndex < 1 + iTrial % 10; ++keyIndex)
+        {
+            keyHitLists.push_back(MakeHitList(nHits(generator), maxHit, generator));
+            index.AddKey(100 + keyIndex, keyHitLists.back());
+        }
+
+        LAR_TEST_CHECK(result, index.GetKeys().size() == keyHitLists.size());
+
+        for (unsigned int iList = 0; iList < 10; ++iList)
+        {
+            const HitList hitList(MakeHitList(nHits(generator), maxHit, generator));
+
+            KeyIndexToCountMap referenceCounts;
+            const unsigned int referenceMatch(GetReferenceMatch(keyHitLists, hitList, referenceCounts));
+
+            Index::KeyIndexAndCountVector sharedHitCounts{{999, 999}};
+            index.GetSharedHitCounts(hitList, sharedHitCounts);
+
+            KeyIndexToCountMap counts;
+            unsigned int bestKeyIndex(keyHitLists.size()), bestSharedHits(0);
+
+            for (const auto &[keyIndex, sharedHits] : sharedHitCounts)
+            {
+                LAR_TEST_CHECK(result, counts.emplace(keyIndex, sharedHits).second);
+
+                // As in the hierarchy matching, ties are resolved in favour of the earliest key
+                if ((sharedHits > bestSharedHits) || ((sharedHits == bestSharedHits) && (keyIndex < bestKeyIndex)))
+                {
+                    bestSharedHits = sharedHits;
+                    bestKeyIndex = keyIndex;
+                }
+            }
+
+            LAR_TEST_CHECK(result, counts == referenceCounts);
+            LAR_TEST_CHECK(result, bestKeyIndex == referenceMatch);
+            LAR_TEST_CHECK(result, (bestKeyIndex == keyHitLists.size()) || (index.GetKeys().at(bestKeyIndex) == 100 + bestKeyIndex));
+        }
+    }
+
+    // The shared hits, for unsorted hit lists in which hits may be repeated
+    for (unsigned int iTrial = 0; iTrial < 50; ++iTrial)
+    {
+        const unsigned int maxHit(10 + 5 * (iTrial % 10));
+        std::uniform_int_distribution<unsigned int> nHits(0, 30);
+
+        HitListVector keyHitLists;
+        Index index;
+
+        for (unsigned int keyIndex = 0; keyIndex < 1 + iTrial % 10; ++keyIndex)
+        {
+            keyHitLists.push_back(MakeHitList(nHits(generator), maxHit, generator));
+            std::shuffle(keyHitLists.back().begin(), keyHitLists.back().end(), generator);
+            index.AddKey(100 + keyIndex, keyHitLists.back());
+        }
+
+        for (unsigned int iList = 0; iList < 10; ++iList)
+        {
+            HitList hitList(MakeHitList(nHits(generator), maxHit, generator));
+            std::shuffle(hitList.begin(), hitList.end(), generator);
+
+            KeyIndexToHitListMap referenceSharedHits;
+            GetReferenceSharedHits(keyHitLists, hitList, referenceSharedHits);
+
+            KeyIndexToHitListMap sharedHits;
+            index.ForEachSharedHit(hitList, [&](const unsigned int keyIndex, const unsigned int hit) { sharedHits[keyIndex].push_back(hit); });
+
+            LAR_TEST_CHECK(result, sharedHits == referenceSharedHits);
+        }
+    }
+
+    return result.Finish("LArHitSharingIndexTest");
+}
@@ -0,0 +1,85 @@
+/**
+ *  @file   test/LArTestHelper.h
+ *
+ *  @brief  Header file for the minimal checking utilities shared by the regression tests.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_TEST_HELPER_H
+#define LAR_TEST_HELPER_H 1
+
+#include <iostream>
+#include <string>
+
+namespace lar_test
+{
+
+/**
+ *  @brief  TestResult class, counting the failed checks in a test executable
+ */
+class TestResult
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    TestResult();
+
+    /**
+     *  @brief  Record the outcome of a check, reporting it if it failed
+     *
+     *  @param  passed whether the check passed
+     *  @param  description the description of the check
+     *  @param  file the source file containing the check
+     *  @param  line the line number of the check
+     */
+    void Check(const bool passed, const std::string &description, const char *const file, const int line);
+
+    /**
+     *  @brief  Report the overall outcome and get the exit code for the test executable
+     *
+     *  @param  testName the name of the test executable
+     *
+     *  @return the exit code, zero if all checks passed
+     */
+    int Finish(const std::string &testName) const;
+
+private:
+    unsigned int m_nChecks; ///< The number of checks made
+    unsigned int m_nFailed; ///< The number of failed checks
+};
+
+#define LAR_TEST_CHECK(result, condition) (result).Check((condition), #condition, __FILE__, __LINE__)
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline TestResult::TestResult() :
+    m_nChecks(0),
+    m_nFailed(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void TestResult::Check(const bool passed, const std::string &description, const char *const file, const int line)
+{
+    ++m_nChecks;
+
+    if (passed)
+        return;
+
+    ++m_nFailed;
+    std::cerr << file << ":" << line << ": check failed: " << description << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline int TestResult::Finish(const std::string &testName) const
+{
+    std::cout << testName << ": " << (m_nChecks - m_nFailed) << " of " << m_nChecks << " checks passed" << std::endl;
+    return (0 == m_nFailed) ? 0 : 1;
+}
+
+} // namespace lar_test
+
+#endif // #ifndef LAR_TEST_HELPER_H
@@ -0,0 +1,152 @@
+/**
+ *  @file   test/LArThreadingHelperTest.cc
+ *
+ *  @brief  Regression test for the threading helper. Overlap results calculated concurrently and then stored must leave exactly the
+ *          same overlap tensor, and must fail at exactly the same point, as a serial loop of calculation and storage.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
+
+#include "test/LArTestHelper.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using namespace lar_content;
+
+namespace lar_test
+{
+
+typedef std::array<unsigned int, 3> Combination;
+typedef std::vector<Combination> CombinationVector;
+typedef std::map<Combination, std::pair<unsigned int, unsigned int>> OverlapTensor;
+typedef std::vector<unsigned int> IndexVector;
+
+/**
+ *  @brief  Calculate a mock overlap result for a combination, an expensive pure function of the combination alone
+ *
+ *  @param  combination the combination
+ *
+ *  @return the overlap result, zero if there is no overlap
+ */
+unsigned int CalculateOverlapResult(const Combination &combination)
+{
+    unsigned int value(combination.at(0) * 7919u + combination.at(1) * 104729u + combination.at(2) * 1299709u);
+
+    for (unsigned int iStep = 0; iStep < 1000; ++iStep)
+        value = value * 1664525u + 1013904223u;
+
+    return (value % 4u) ? value % 1000u : 0u;
+}
+
+/**
+ *  @brief  Calculate and store the overlap results for a list of combinations, where later results replace earlier results for the same
+ *          tensor element only if they are larger. Each element records the index of the combination stored, so the stored tensor depends
+ *          on the order of storage
+ *
+ *  @param  combinations the combinations
+ *  @param  nThreads the maximum number of threads to use
+ *  @param  throwIndices the indices of the combinations for which the calculation throws, with the index as the exception message
+ *  @param  overlapTensor to receive the overlap tensor
+ *  @param  storedIndices to receive the indices of the stored combinations, in order of storage
+ *
+ *  @return the message of the exception rethrown, empty if none
+ */
+std::string FillOverlapTensor(const CombinationVector &combinations, const unsigned int nThreads, const IndexVector &throwIndices,
+    OverlapTensor &overlapTensor, IndexVector &storedIndices)
+{
+    try
+    {
+        LArThreadingHelper::ParallelCalculateThenStore<unsigned int>(combinations.size(), nThreads,
+            [&](const unsigned int index, unsigned int &overlapResult) {
+                if (throwIndices.end() != std::find(throwIndices.begin(), throwIndices.end(), index))
+                    throw std::runtime_error(std::to_string(index));
+
+                overlapResult = CalculateOverlapResult(combinations.at(index));
+            },
+            [&](const unsigned int index, const unsigned int overlapResult) {
+                storedIndices.push_back(index);
+
+                if (0 == overlapResult)
+                    return;
+
+                // ATTN Key on the first two clusters only, so that combinations compete for the same element
+                const Combination key{combinations.at(index).at(0), combinations.at(index).at(1), 0u};
+                auto iter(overlapTensor.find(key));
+
+                if (overlapTensor.end() == iter)
+                {
+                    overlapTensor.emplace(key, std::make_pair(overlapResult, index));
+                }
+                else if (overlapResult > iter->second.first)
+                {
+                    iter->second = std::make_pair(overlapResult, index);
+                }
+            });
+    }
+    catch (const std::runtime_error &exception)
+    {
+        return exception.what();
+    }
+
+    return std::string();
+}
+
+} // namespace lar_test
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    using namespace lar_test;
+
+    TestResult result;
+    std::mt19937 generator(12345);
+
+    for (unsigned int iTrial = 0; iTrial < 20; ++iTrial)
+    {
+        CombinationVector combinations;
+        std::uniform_int_distribution<unsigned int> cluster(0, 4 + iTrial);
+
+        for (unsigned int iCombination = 0; iCombination < 50 * iTrial; ++iCombination)
+            combinations.push_back({cluster(generator), cluster(generator), cluster(generator)});
+
+        IndexVector throwIndices;
+
+        // ATTN Every other trial has calculations that throw, with the earliest such combination deciding the rethrown exception
+        if ((iTrial % 2) && !combinations.empty())
+        {
+            std::uniform_int_distribution<unsigned int> index(0, combinations.size() - 1);
+            throwIndices = {index(generator), index(generator), index(generator)};
+        }
+
+        const unsigned int firstThrowIndex(throwIndices.empty() ? combinations.size() : *std::min_element(throwIndices.begin(), throwIndices.end()));
+
+        OverlapTensor serialTensor;
+        IndexVector serialStoredIndices;
+        const std::string serialException(FillOverlapTensor(combinations, 1, throwIndices, serialTensor, serialStoredIndices));
+
+        LAR_TEST_CHECK(result, serialStoredIndices.size() == firstThrowIndex);
+        LAR_TEST_CHECK(result, serialException == (throwIndices.empty() ? std::string() : std::to_string(firstThrowIndex)));
+
+        for (const unsigned int nThreads : {2u, 4u, 16u})
+        {
+            OverlapTensor parallelTensor;
+            IndexVector parallelStoredIndices;
+            const std::string parallelException(FillOverlapTensor(combinations, nThreads, throwIndices, parallelTensor, parallelStoredIndices));
+
+            LAR_TEST_CHECK(result, parallelTensor == serialTensor);
+            LAR_TEST_CHECK(result, parallelStoredIndices == serialStoredIndices);
+            LAR_TEST_CHECK(result, parallelException == serialException);
+        }
+    }
+
+    return result.Finish("LArThreadingHelperTest");
+}